@@ -18,15 +18,58 @@
 #include "platform/platform.h"
 
 #include <stdio.h>
+#include <inttypes.h>
 
 #include "arm_2d.h"
 #include "arm_2d_helper.h"
 #include "arm_2d_disp_adapters.h"
 #include "arm_2d_scenes.h"
 #include "arm_2d_demos.h"
+#include "arm_2d_scene_bubble_charging.h"
+
+#if DEMO_CFG_BENCHMARK_RGB565_SPAN
+#   include "arm_2d_user_opcode_benchmark.h"
+#endif
 
 
 /*============================ MACROS ========================================*/
+
+/* load the next scene in the idle time before the current one times out.
+ * Both scenes stay in the heap from the preloading to the switching, i.e. for
+ * DEMO_CFG_PRELOAD_LEAD_TIME_MS, so the heap must hold the two largest
+ * neighbouring scenes at once. Only the switching made by the demo timer is
+ * preloaded, a manual one may still be cancelled.
+ */
+#ifndef DEMO_CFG_PRELOAD_NEXT_SCENE
+#   define DEMO_CFG_PRELOAD_NEXT_SCENE          0
+#endif
+
+/* how long (in ms) before the switching the next scene is loaded */
+#ifndef DEMO_CFG_PRELOAD_LEAD_TIME_MS
+#   define DEMO_CFG_PRELOAD_LEAD_TIME_MS        1000
+#endif
+
+/* walk through every scene for a fixed number of frames and print a CSV table */
+#ifndef DEMO_CFG_BENCHMARK_MODE
+#   define DEMO_CFG_BENCHMARK_MODE              0
+#endif
+
+/* the number of frames each scene runs in the benchmark mode */
+#ifndef DEMO_CFG_BENCHMARK_FRAMES
+#   define DEMO_CFG_BENCHMARK_FRAMES            300
+#endif
+
+/* measure the RGB565 span blending of the user opcodes once at startup */
+#ifndef DEMO_CFG_BENCHMARK_RGB565_SPAN
+#   define DEMO_CFG_BENCHMARK_RGB565_SPAN       0
+#endif
+
+#if DEMO_CFG_BENCHMARK_MODE
+/* scenes are switched by the frame count rather than by time */
+#   undef DEMO_CFG_PRELOAD_NEXT_SCENE
+#   define DEMO_CFG_PRELOAD_NEXT_SCENE          0
+#endif
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
 /*============================ GLOBAL VARIABLES ==============================*/
@@ -35,65 +78,80 @@
 /*============================ IMPLEMENTATION ================================*/
 
 
-void scene_rickrolling_loader(void) 
+arm_2d_scene_t *scene_rickrolling_loader(void) 
 {
-    arm_2d_scene_rickrolling_init(&DISP0_ADAPTER);
+    return (arm_2d_scene_t *)arm_2d_scene_rickrolling_init(&DISP0_ADAPTER);
 }
 
-void scene_qrcode_loader(void) 
+arm_2d_scene_t *scene_qrcode_loader(void) 
 {
-    arm_2d_scene_qrcode_init(&DISP0_ADAPTER);
+    return (arm_2d_scene_t *)arm_2d_scene_qrcode_init(&DISP0_ADAPTER);
 }
 
-void scene_user_defined_opcode_loader(void) 
+arm_2d_scene_t *scene_user_defined_opcode_loader(void) 
 {
-    arm_2d_scene_user_defined_opcode_init(&DISP0_ADAPTER);
+    return (arm_2d_scene_t *)arm_2d_scene_user_defined_opcode_init(&DISP0_ADAPTER);
 }
 
-void scene_space_badge_loader(void) 
+arm_2d_scene_t *scene_space_badge_loader(void) 
 {
-    arm_2d_scene_space_badge_init(&DISP0_ADAPTER);
+    return (arm_2d_scene_t *)arm_2d_scene_space_badge_init(&DISP0_ADAPTER);
 }
 
-void scene_music_player_loader(void) 
+arm_2d_scene_t *scene_music_player_loader(void) 
 {
-    arm_2d_scene_music_player_init(&DISP0_ADAPTER);
+    return (arm_2d_scene_t *)arm_2d_scene_music_player_init(&DISP0_ADAPTER);
 }
 
 
-void scene_watch_face_01_loader(void) 
+arm_2d_scene_t *scene_watch_face_01_loader(void) 
 {
-    arm_2d_scene_watch_face_01_init(&DISP0_ADAPTER);
+    return (arm_2d_scene_t *)arm_2d_scene_watch_face_01_init(&DISP0_ADAPTER);
 }
 
-void scene_matrix_loader(void) 
+arm_2d_scene_t *scene_matrix_loader(void) 
 {
-    arm_2d_scene_matrix_init(&DISP0_ADAPTER);
+    return (arm_2d_scene_t *)arm_2d_scene_matrix_init(&DISP0_ADAPTER);
+}
+
+arm_2d_scene_t *scene_compass_loader(void) 
+{
+    return (arm_2d_scene_t *)arm_2d_scene_compass_init(&DISP0_ADAPTER);
+}
+
+arm_2d_scene_t *scene_bubble_charging_loader(void) 
+{
+    return (arm_2d_scene_t *)arm_2d_scene_bubble_charging_init(&DISP0_ADAPTER);
 }
 
 
 typedef struct demo_scene_t {
     int32_t nLastInMS;
-    void (*fnLoader)(void);
+    arm_2d_scene_t *(*fnLoader)(void);  /* returns NULL on failure */
+    uint16_t hwTargetFPS;               /* 0 means no limitation */
+    const char *pchName;
 } demo_scene_t;
 
 static demo_scene_t const c_SceneLoaders[] = {
 
-#if 0
-    {
-        5000,
-        scene_qrcode_loader,
-    },
-    {
-        20000,
-        scene_rickrolling_loader,
-    },
+#if DEMO_CFG_BENCHMARK_MODE
+    /* every scene runs at full speed for DEMO_CFG_BENCHMARK_FRAMES frames */
+    {.fnLoader = scene_qrcode_loader,               .pchName = "qrcode",},
+    {.fnLoader = scene_rickrolling_loader,          .pchName = "rickrolling",},
+    {.fnLoader = scene_user_defined_opcode_loader,  .pchName = "user_defined_opcode",},
+    {.fnLoader = scene_space_badge_loader,          .pchName = "space_badge",},
+    {.fnLoader = scene_music_player_loader,         .pchName = "music_player",},
+    {.fnLoader = scene_watch_face_01_loader,        .pchName = "watch_face_01",},
+    {.fnLoader = scene_matrix_loader,               .pchName = "matrix",},
+    {.fnLoader = scene_compass_loader,              .pchName = "compass",},
+    {.fnLoader = scene_bubble_charging_loader,      .pchName = "bubble_charging",},
 #else
     {
         .fnLoader = 
         scene_space_badge_loader,
         //scene_qrcode_loader,
         //scene_mono_clock_loader
+        .hwTargetFPS = 10,
     },
 #endif
 
@@ -102,47 +160,275 @@ static demo_scene_t const c_SceneLoaders[] = {
 static
 struct {
     int8_t chIndex;
+    int8_t chPreloaded;                 /* -1 means nothing is preloaded */
     bool bIsTimeout;
+    bool bSwitchedByTimer;              /* the current switching is the demo's */
+    bool bCanPreload;                   /* the current scene came from the timer */
     int32_t nDelay;
     int64_t lTimeStamp;
+    int64_t lPreloadTimeStamp;
     
 } s_tDemoCTRL = {
     .chIndex = -1,
+    .chPreloaded = -1,
     .bIsTimeout = true,
 };
 
+#if DEMO_CFG_BENCHMARK_MODE
+typedef struct demo_benchmark_result_t {
+    uint32_t wFPS;
+    float fCPUUsage;
+    uint32_t wLCDLatencyMS;
+    uint32_t wMemoryPeak;
+    uint32_t wBusBytesPerFrame;
+    uint32_t wFrameCyclesAvg;           /* needs the virtual timebase */
+} demo_benchmark_result_t;
+
+static
+struct {
+    demo_benchmark_result_t tResults[dimof(c_SceneLoaders)];
+    int64_t lStart;                     /* real ticks, when the transition ends */
+    void (*fnAfterSwitch)(arm_2d_scene_t *ptScene); /* the scene's own handler */
+    uint64_t dwRenderCycles;
+    uint64_t dwLCDCycles;
+    uint32_t wBusBytes;
+    uint64_t dwFrameCycles;
+    uint16_t hwFrames;
+    bool bRunning;
+} s_tBenchmark;
+#endif
+
+#if DEMO_CFG_BENCHMARK_MODE
+/* open the timing window of the current scene */
+static void benchmark_start(void)
+{
+    s_tBenchmark.hwFrames = 0;
+    s_tBenchmark.dwRenderCycles = 0;
+    s_tBenchmark.dwLCDCycles = 0;
+    s_tBenchmark.dwFrameCycles = 0;
+    s_tBenchmark.wBusBytes = platform_get_lcd_bus_bytes();
+    platform_reset_memory_peak();
+    s_tBenchmark.lStart = arm_2d_helper_get_system_timestamp();
+    s_tBenchmark.bRunning = true;
+}
+
+/* the transition has ended, give the scene its own handler back and start */
+static void benchmark_on_scene_switched(arm_2d_scene_t *ptScene)
+{
+    ptScene->fnAfterSwitch = s_tBenchmark.fnAfterSwitch;
+    if (NULL != ptScene->fnAfterSwitch) {
+        ptScene->fnAfterSwitch(ptScene);
+    }
+
+    benchmark_start();
+}
+
+/* start measuring the new scene when the scene player finishes switching */
+static void benchmark_hook_scene(arm_2d_scene_t *ptScene)
+{
+    if (NULL == ptScene) {
+        /* the scene failed to load, measure whatever is on the screen */
+        benchmark_start();
+        return ;
+    }
+
+    s_tBenchmark.fnAfterSwitch = ptScene->fnAfterSwitch;
+    ptScene->fnAfterSwitch = &benchmark_on_scene_switched;
+}
+#endif
+
+static int8_t get_scene_index(int_fast16_t iIndex)
+{
+    if (iIndex >= (int_fast16_t)dimof(c_SceneLoaders)) {
+        iIndex = 0;
+    } else if (iIndex < 0) {
+        iIndex += dimof(c_SceneLoaders);
+    }
+
+    return (int8_t)iIndex;
+}
+
 /* load scene one by one */
 void before_scene_switching_handler(void *pTarget,
                                     arm_2d_scene_player_t *ptPlayer,
                                     arm_2d_scene_t *ptScene)
 {
+    int64_t lStart = arm_2d_helper_get_system_timestamp();
+    bool bPreloaded = false;
 
     switch (arm_2d_scene_player_get_switching_status(&DISP0_ADAPTER)) {
         case ARM_2D_SCENE_SWITCH_STATUS_MANUAL_CANCEL:
-            s_tDemoCTRL.chIndex--;
+            /* going back always wins. A scene is only preloaded after a 
+             * switching of the demo timer, which is never cancelled, so 
+             * nothing is preloaded here.
+             */
+            s_tDemoCTRL.chIndex = get_scene_index(s_tDemoCTRL.chIndex - 1);
             break;
         default:
-            s_tDemoCTRL.chIndex++;
+            if (s_tDemoCTRL.chPreloaded >= 0) {
+                /* the preloaded scene has already been appended to the scene 
+                 * player, it is the one we are switching to.
+                 */
+                s_tDemoCTRL.chIndex = s_tDemoCTRL.chPreloaded;
+                bPreloaded = true;
+            } else {
+                s_tDemoCTRL.chIndex = get_scene_index(s_tDemoCTRL.chIndex + 1);
+            }
             break;
     }
+    s_tDemoCTRL.chPreloaded = -1;
 
-    if (s_tDemoCTRL.chIndex >= dimof(c_SceneLoaders)) {
-        s_tDemoCTRL.chIndex = 0;
-    } else if (s_tDemoCTRL.chIndex < 0) {
-        s_tDemoCTRL.chIndex += dimof(c_SceneLoaders);
-    }
+    /* a manual switching may be cancelled later, don't preload after it */
+    s_tDemoCTRL.bCanPreload = s_tDemoCTRL.bSwitchedByTimer;
+    s_tDemoCTRL.bSwitchedByTimer = false;
+
+#if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+    /* the latency percentiles are per scene */
+    disp_adapter0_reset_frame_statistics();
+#endif
+
+#if DEMO_CFG_BENCHMARK_MODE
+    /* nothing is measured until the transition ends */
+    s_tBenchmark.bRunning = false;
+#   if __DISP0_CFG_VIRTUAL_TIMEBASE__
+    /* every scene starts from the same virtual time */
+    disp_adapter0_set_virtual_timebase(true);
+#   endif
+#endif
 
     /* call loader */
     arm_with(const demo_scene_t, &c_SceneLoaders[s_tDemoCTRL.chIndex]) {
         if (_->nLastInMS > 0) {
             s_tDemoCTRL.bIsTimeout = false;
             s_tDemoCTRL.lTimeStamp = 0;
+            s_tDemoCTRL.lPreloadTimeStamp = 0;
             s_tDemoCTRL.nDelay = _->nLastInMS;
         }
-        _->fnLoader();
+    #if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+        disp_adapter0_set_target_fps(_->hwTargetFPS);
+    #endif
+        if (!bPreloaded) {
+        #if DEMO_CFG_BENCHMARK_MODE
+            benchmark_hook_scene(_->fnLoader());
+        #else
+            _->fnLoader();
+        #endif
+        }
     }
+
+    /* report the time spent on switching, i.e. the hitch between two scenes */
+    do {
+        int64_t lElapsed = arm_2d_helper_get_system_timestamp() - lStart;
+        ARM_2D_LOG_INFO(
+            STATISTICS, 
+            0, 
+            "DEMO", 
+            "Switch to scene %d in %"PRIu32"us%s",
+            s_tDemoCTRL.chIndex,
+            (uint32_t)(     (lElapsed * 1000000ll) 
+                        /   arm_2d_helper_get_reference_clock_frequency()),
+            bPreloaded ? " (preloaded)" : "");
+    } while(0);
 }
 
+#if DEMO_CFG_BENCHMARK_MODE
+static void benchmark_print_results(void)
+{
+    printf("\r\nscene,frames,fps,cpu_usage,lcd_latency_ms,"
+           "memory_peak_bytes,bus_bytes_per_frame,frame_cycles\r\n");
+
+    for (int_fast16_t n = 0; n < (int_fast16_t)dimof(c_SceneLoaders); n++) {
+        arm_with(const demo_benchmark_result_t, &s_tBenchmark.tResults[n]) {
+            printf( "%s,%d,%"PRIu32",%2.2f,%"PRIu32",%"PRIu32",%"PRIu32",%"PRIu32"\r\n",
+                    c_SceneLoaders[n].pchName,
+                    DEMO_CFG_BENCHMARK_FRAMES,
+                    _->wFPS,
+                    (double)_->fCPUUsage,
+                    _->wLCDLatencyMS,
+                    _->wMemoryPeak,
+                    _->wBusBytesPerFrame,
+                    _->wFrameCyclesAvg);
+        }
+    }
+}
+
+/* count the frames of the current scene, record the result and move on */
+static void benchmark_on_frame_complete(void)
+{
+    if (!s_tBenchmark.bRunning) {
+        return ;
+    }
+
+    /* the statistics of the PFB helper are measured with the real clock */
+    arm_with(arm_2d_helper_pfb_t, &DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t) {
+        s_tBenchmark.dwRenderCycles += (uint32_t)_->Statistics.nTotalCycle;
+        s_tBenchmark.dwLCDCycles += (uint32_t)_->Statistics.nRenderingCycle;
+    }
+
+#if __DISP0_CFG_VIRTUAL_TIMEBASE__
+    s_tBenchmark.dwFrameCycles += (uint32_t)disp_adapter0_get_frame_cycles();
+#endif
+
+    if (++s_tBenchmark.hwFrames < DEMO_CFG_BENCHMARK_FRAMES) {
+        return ;
+    }
+    s_tBenchmark.bRunning = false;
+
+    int64_t lElapsed = arm_2d_helper_get_system_timestamp() - s_tBenchmark.lStart;
+
+    arm_with(demo_benchmark_result_t, &s_tBenchmark.tResults[s_tDemoCTRL.chIndex]) {
+        if (lElapsed > 0) {
+            _->wFPS = (uint32_t)(   (int64_t)DEMO_CFG_BENCHMARK_FRAMES 
+                                *   arm_2d_helper_get_reference_clock_frequency()
+                                /   lElapsed);
+            _->fCPUUsage = (float)(     (double)s_tBenchmark.dwRenderCycles 
+                                    /   (double)lElapsed) * 100.0f;
+        }
+        _->wLCDLatencyMS = (uint32_t)arm_2d_helper_convert_ticks_to_ms(
+                                        (int64_t)(  s_tBenchmark.dwLCDCycles 
+                                                 /  DEMO_CFG_BENCHMARK_FRAMES));
+        _->wMemoryPeak = platform_get_memory_peak();
+        _->wBusBytesPerFrame = (platform_get_lcd_bus_bytes() - s_tBenchmark.wBusBytes)
+                             / DEMO_CFG_BENCHMARK_FRAMES;
+        _->wFrameCyclesAvg = (uint32_t)(s_tBenchmark.dwFrameCycles 
+                                     /  DEMO_CFG_BENCHMARK_FRAMES);
+    }
+
+    if (s_tDemoCTRL.chIndex + 1 >= (int_fast16_t)dimof(c_SceneLoaders)) {
+        /* all scenes are done, stay in the last one */
+        benchmark_print_results();
+    } else {
+        arm_2d_scene_player_switch_to_next_scene(&DISP0_ADAPTER);
+    }
+}
+#endif
+
+#if DEMO_CFG_PRELOAD_NEXT_SCENE
+/* load the next scene in the idle time between two frames, so the switching
+ * only needs to swap the scenes.
+ */
+static void preload_next_scene(void)
+{
+    if (    s_tDemoCTRL.bIsTimeout 
+        ||  !s_tDemoCTRL.bCanPreload
+        ||  s_tDemoCTRL.chPreloaded >= 0) {
+        /* no pending switching, the scene came from a manual switching or 
+         * the next scene is ready 
+         */
+        return ;
+    }
+
+    if (!arm_2d_helper_is_time_out(
+                        MAX(s_tDemoCTRL.nDelay - DEMO_CFG_PRELOAD_LEAD_TIME_MS, 0),
+                        &s_tDemoCTRL.lPreloadTimeStamp)) {
+        return ;
+    }
+
+    s_tDemoCTRL.chPreloaded = get_scene_index(s_tDemoCTRL.chIndex + 1);
+    c_SceneLoaders[s_tDemoCTRL.chPreloaded].fnLoader();
+}
+#endif
+
 
 static void system_init(void)
 {
@@ -171,17 +457,30 @@ int main(void)
     coremark_main();
 #endif
 
+#if DEMO_CFG_BENCHMARK_RGB565_SPAN
+    printf("\r\nBenchmark the RGB565 spans...\r\n");
+    arm_2d_user_opcode_benchmark_rgb565_span();
+#endif
+
+    s_tDemoCTRL.bSwitchedByTimer = true;
     arm_2d_scene_player_switch_to_next_scene(&DISP0_ADAPTER);
 
     while (true) {
 
-        disp_adapter0_task();
+        if (arm_fsm_rt_cpl == disp_adapter0_task()) {
+        #if DEMO_CFG_BENCHMARK_MODE
+            benchmark_on_frame_complete();
+        #elif DEMO_CFG_PRELOAD_NEXT_SCENE
+            preload_next_scene();
+        #endif
+        }
 
         if (!s_tDemoCTRL.bIsTimeout) {
 
             if (arm_2d_helper_is_time_out(s_tDemoCTRL.nDelay, &s_tDemoCTRL.lTimeStamp)) {
                 s_tDemoCTRL.bIsTimeout = true;
 
+                s_tDemoCTRL.bSwitchedByTimer = true;
                 arm_2d_scene_player_switch_to_next_scene(&DISP0_ADAPTER);
             }
         }
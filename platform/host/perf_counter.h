@@ -0,0 +1,71 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * The subset of perf_counter used by this project, for host builds. Put this
+ * directory in front of the include path so it replaces the real one.
+ */
+
+#ifndef __PERF_COUNTER_HOST_H__
+#define __PERF_COUNTER_HOST_H__
+
+/*============================ INCLUDES ======================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================ MACROS ========================================*/
+
+/* the host ticks are nanoseconds */
+#define PERF_COUNTER_HOST_TICKS_PER_SEC     1000000000ul
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+#define __cycleof__(__STR, ...)                                                 \
+            for (int64_t __cycle_start = get_system_ticks(), __cycle_once = 1;  \
+                 __cycle_once;                                                  \
+                 __cycle_once = 0,                                              \
+                 printf("\r\n-[Cycle Report]"                                   \
+                        "--------------------------------------------\r\n"      \
+                        "%s total cycle count: %lld [%016llx]\r\n",             \
+                        (__STR),                                                \
+                        (long long)(get_system_ticks() - __cycle_start),        \
+                        (long long)(get_system_ticks() - __cycle_start)))
+
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+
+extern uint32_t SystemCoreClock;
+
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+
+extern
+int64_t get_system_ticks(void);
+
+extern
+void init_cycle_counter(bool bIsSysTickOccupied);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
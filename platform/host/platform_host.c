@@ -0,0 +1,180 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * The host (Linux) replacement of platform.c. It is compiled together with
+ * main.c, the scenes and the display adapter when __PLATFORM_HOST__ is
+ * defined, see "How to build for the host" in README.md.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include "../platform.h"
+#include "../mem_banks.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "arm_2d.h"
+#include "arm_2d_helper.h"
+#include "arm_2d_disp_adapters.h"
+
+#include "st7789_host.h"
+
+/*============================ MACROS ========================================*/
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__                                         \
+    ||  __DISP0_CFG_VRES_PREFETCH__                                             \
+    ||  __DISP0_CFG_COLOUR_DEPTH__ != 16
+#   error The host build only supports the RGB565 display adapter without \
+the frame governor and the virtual resource prefetching.
+#endif
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+
+uint32_t SystemCoreClock = PERF_COUNTER_HOST_TICKS_PER_SEC;
+
+/*============================ LOCAL VARIABLES ===============================*/
+
+static uint32_t s_wLCDBusBytes = 0;
+
+static struct {
+    const char *pchDirectory;           /* NULL means no dumping */
+    uint32_t wFrame;
+} s_tDump;
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+int64_t get_system_ticks(void)
+{
+    struct timespec tNow;
+    clock_gettime(CLOCK_MONOTONIC, &tNow);
+
+    return (int64_t)tNow.tv_sec * (int64_t)PERF_COUNTER_HOST_TICKS_PER_SEC
+         + (int64_t)tNow.tv_nsec;
+}
+
+void init_cycle_counter(bool bIsSysTickOccupied)
+{
+    ARM_2D_UNUSED(bIsSysTickOccupied);
+}
+
+int64_t arm_2d_helper_get_system_timestamp(void)
+{
+    return get_system_ticks();
+}
+
+uint32_t arm_2d_helper_get_reference_clock_frequency(void)
+{
+    return SystemCoreClock;
+}
+
+void Disp0_DrawBitmap(  int16_t x,
+                        int16_t y,
+                        int16_t width,
+                        int16_t height,
+                        const uint8_t *pchBitmap)
+{
+    s_wLCDBusBytes += (uint32_t)width * (uint32_t)height * sizeof(uint16_t);
+    st7789_draw_bitmap(x, y, width, height, pchBitmap);
+}
+
+#if __DISP0_CFG_ENABLE_ASYNC_FLUSHING__
+void __disp_adapter0_request_async_flushing(void *pTarget,
+                                            bool bIsNewFrame,
+                                            int16_t iX,
+                                            int16_t iY,
+                                            int16_t iWidth,
+                                            int16_t iHeight,
+                                            const uint16_t *phwBuffer)
+{
+    ARM_2D_UNUSED(pTarget);
+    ARM_2D_UNUSED(bIsNewFrame);
+
+    s_wLCDBusBytes += (uint32_t)iWidth * (uint32_t)iHeight * sizeof(uint16_t);
+    st7789_draw_bitmap_async(iX, iY, iWidth, iHeight, (const uint8_t *)phwBuffer);
+}
+
+void st7789_insert_async_flush_cpl_evt_handler(void)
+{
+    disp_adapter0_insert_async_flushing_complete_event_handler();
+}
+#endif
+
+/* dump every frame into TUFTY_HOST_DUMP_DIR when it is set */
+void __disp_adapter0_user_on_frame_complete(void *ptTarget,
+                                            bool bIsFrameSkipped)
+{
+    ARM_2D_UNUSED(ptTarget);
+
+    if (NULL == s_tDump.pchDirectory || bIsFrameSkipped) {
+        return ;
+    }
+
+    char chPath[256];
+    snprintf(   chPath,
+                sizeof(chPath),
+                "%s/frame_%05u.ppm",
+                s_tDump.pchDirectory,
+                (unsigned)s_tDump.wFrame++);
+
+    if (!st7789_host_dump_ppm(chPath)) {
+        printf("Failed to dump %s\r\n", chPath);
+        s_tDump.pchDirectory = NULL;
+    }
+}
+
+void __disp_adapter0_user_log_statistics(void)
+{
+    ARM_2D_LOG_INFO(
+        STATISTICS,
+        0,
+        "HOST",
+        "LCD Bus Bytes:%u Modelled Bus Time:%ums",
+        (unsigned)s_wLCDBusBytes,
+        (unsigned)(st7789_host_get_bus_time_us() / 1000ull)
+    );
+
+    mem_banks_log_statistics();
+}
+
+uint32_t platform_get_lcd_bus_bytes(void)
+{
+    return s_wLCDBusBytes;
+}
+
+uint32_t platform_get_memory_peak(void)
+{
+    /* the scratch memory comes from mem_banks.c, as on the target */
+    return mem_banks_get_peak();
+}
+
+void platform_reset_memory_peak(void)
+{
+    mem_banks_reset_peak();
+}
+
+void platform_init(void)
+{
+    s_tDump.pchDirectory = getenv("TUFTY_HOST_DUMP_DIR");
+    s_tDump.wFrame = 0;
+
+    st7789_init();
+}
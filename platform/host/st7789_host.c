@@ -0,0 +1,263 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * A stand-in of st7789_simple.c for host builds: the LCD is a RGB565 image in
+ * memory and every transfer takes the time the 8-bit parallel bus would take.
+ * A blocking draw sleeps until its bytes are on the bus. An asynchronous one
+ * returns at once and a worker thread, standing in for the DMA interrupt,
+ * raises the flush-complete event when the transfer ends.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include "st7789_host.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+/*============================ MACROS ========================================*/
+
+/* the clock of the PIO state machine, see st7789_pio_stream_init() */
+#ifndef ST7789_HOST_PIO_CLOCK_HZ
+#   define ST7789_HOST_PIO_CLOCK_HZ         62500000ull
+#endif
+
+/* st77xx_parallel_stream: "out pins, 8" and "nop side 1 [1]" */
+#ifndef ST7789_HOST_PIO_CYCLES_PER_BYTE
+#   define ST7789_HOST_PIO_CYCLES_PER_BYTE  3ull
+#endif
+
+/* CASET, RASET and RAMWR, plus the 4-byte parameters of CASET and RASET */
+#define __ST7789_HOST_COMMAND_BYTES         (3 + 4 + 4)
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+static uint16_t s_hwFrame[ST7789_HEIGHT][ST7789_WIDTH];
+static uint64_t s_dwBusBytes = 0;
+
+static struct {
+    pthread_t tThread;
+    pthread_mutex_t tMutex;
+    pthread_cond_t tRequest;
+    int64_t lBusFreeAt;                 /* CLOCK_MONOTONIC, in ns */
+    int64_t lCompleteAt;                /* of the pending async transfer */
+    bool bPending;
+    bool bStarted;
+} s_tBus = {
+    .tMutex = PTHREAD_MUTEX_INITIALIZER,
+    .tRequest = PTHREAD_COND_INITIALIZER,
+};
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+static int64_t __st7789_host_now_ns(void)
+{
+    struct timespec tNow;
+    clock_gettime(CLOCK_MONOTONIC, &tNow);
+
+    return (int64_t)tNow.tv_sec * 1000000000ll + (int64_t)tNow.tv_nsec;
+}
+
+static void __st7789_host_sleep_until(int64_t lTime)
+{
+    struct timespec tTime = {
+        .tv_sec = (time_t)(lTime / 1000000000ll),
+        .tv_nsec = (long)(lTime % 1000000000ll),
+    };
+
+    while (EINTR == clock_nanosleep(CLOCK_MONOTONIC,
+                                    TIMER_ABSTIME,
+                                    &tTime,
+                                    NULL));
+}
+
+static int64_t __st7789_host_get_transfer_ns(uint64_t dwBytes)
+{
+    return (int64_t)(   dwBytes 
+                    *   ST7789_HOST_PIO_CYCLES_PER_BYTE 
+                    *   1000000000ull 
+                    /   ST7789_HOST_PIO_CLOCK_HZ);
+}
+
+/* put the bytes on the modelled bus, return when the transfer ends */
+static int64_t __st7789_host_bus_transfer(uint64_t dwBytes)
+{
+    int64_t lNow = __st7789_host_now_ns();
+
+    pthread_mutex_lock(&s_tBus.tMutex);
+    int64_t lStart = (s_tBus.lBusFreeAt > lNow) ? s_tBus.lBusFreeAt : lNow;
+    s_tBus.lBusFreeAt = lStart + __st7789_host_get_transfer_ns(dwBytes);
+    int64_t lEnd = s_tBus.lBusFreeAt;
+    s_dwBusBytes += dwBytes;
+    pthread_mutex_unlock(&s_tBus.tMutex);
+
+    return lEnd;
+}
+
+/* the stand-in of the DMA interrupt */
+static void *__st7789_host_bus_thread(void *pArg)
+{
+    extern void st7789_insert_async_flush_cpl_evt_handler(void);
+    (void)pArg;
+
+    pthread_mutex_lock(&s_tBus.tMutex);
+    while (true) {
+        while (!s_tBus.bPending) {
+            pthread_cond_wait(&s_tBus.tRequest, &s_tBus.tMutex);
+        }
+        int64_t lCompleteAt = s_tBus.lCompleteAt;
+        pthread_mutex_unlock(&s_tBus.tMutex);
+
+        __st7789_host_sleep_until(lCompleteAt);
+
+        pthread_mutex_lock(&s_tBus.tMutex);
+        s_tBus.bPending = false;
+        pthread_mutex_unlock(&s_tBus.tMutex);
+
+        st7789_insert_async_flush_cpl_evt_handler();
+
+        pthread_mutex_lock(&s_tBus.tMutex);
+    }
+
+    return NULL;
+}
+
+void st7789_init(void)
+{
+    memset(s_hwFrame, 0, sizeof(s_hwFrame));
+    s_dwBusBytes = 0;
+
+    pthread_mutex_lock(&s_tBus.tMutex);
+    s_tBus.lBusFreeAt = 0;
+    if (!s_tBus.bStarted) {
+        s_tBus.bStarted = (0 == pthread_create( &s_tBus.tThread,
+                                                NULL,
+                                                &__st7789_host_bus_thread,
+                                                NULL));
+        assert(s_tBus.bStarted);
+    }
+    pthread_mutex_unlock(&s_tBus.tMutex);
+}
+
+static uint64_t __st7789_host_copy_bitmap(  int16_t x,
+                                            int16_t y,
+                                            int16_t width,
+                                            int16_t height,
+                                            const uint8_t *pchBitmap)
+{
+    assert(NULL != pchBitmap);
+    assert(x >= 0 && y >= 0);
+    assert(x + width <= ST7789_WIDTH);
+    assert(y + height <= ST7789_HEIGHT);
+
+    const uint16_t *phwSource = (const uint16_t *)pchBitmap;
+
+    for (int16_t iY = 0; iY < height; iY++) {
+        memcpy( &s_hwFrame[y + iY][x],
+                phwSource,
+                (size_t)width * sizeof(uint16_t));
+        phwSource += width;
+    }
+
+    return  __ST7789_HOST_COMMAND_BYTES 
+        +   (uint64_t)width * (uint64_t)height * sizeof(uint16_t);
+}
+
+void st7789_draw_bitmap(int16_t x,
+                        int16_t y,
+                        int16_t width,
+                        int16_t height,
+                        const uint8_t *pchBitmap)
+{
+    uint64_t dwBytes = __st7789_host_copy_bitmap(x, y, width, height, pchBitmap);
+
+    /* the blocking driver returns when the bytes are on the bus */
+    __st7789_host_sleep_until(__st7789_host_bus_transfer(dwBytes));
+}
+
+void st7789_draw_bitmap_async(  int16_t x,
+                                int16_t y,
+                                int16_t width,
+                                int16_t height,
+                                const uint8_t *pchBitmap)
+{
+    /* the pixels are copied at once, the PFB is not touched until the 
+     * flush-complete event anyway 
+     */
+    uint64_t dwBytes = __st7789_host_copy_bitmap(x, y, width, height, pchBitmap);
+    int64_t lCompleteAt = __st7789_host_bus_transfer(dwBytes);
+
+    pthread_mutex_lock(&s_tBus.tMutex);
+    /* like the DMA channel, only one transfer is in flight */
+    assert(!s_tBus.bPending);
+    s_tBus.lCompleteAt = lCompleteAt;
+    s_tBus.bPending = true;
+    pthread_cond_signal(&s_tBus.tRequest);
+    pthread_mutex_unlock(&s_tBus.tMutex);
+}
+
+const uint16_t *st7789_host_get_framebuffer(void)
+{
+    return &s_hwFrame[0][0];
+}
+
+uint64_t st7789_host_get_bus_time_us(void)
+{
+    return (uint64_t)__st7789_host_get_transfer_ns(s_dwBusBytes) / 1000ull;
+}
+
+bool st7789_host_dump_ppm(const char *pchPath)
+{
+    FILE *ptFile = fopen(pchPath, "wb");
+    if (NULL == ptFile) {
+        return false;
+    }
+
+    fprintf(ptFile, "P6\n%d %d\n255\n", ST7789_WIDTH, ST7789_HEIGHT);
+
+    bool bResult = true;
+    for (int iY = 0; iY < ST7789_HEIGHT && bResult; iY++) {
+        uint8_t chLine[ST7789_WIDTH * 3];
+        uint8_t *pchRGB = chLine;
+
+        for (int iX = 0; iX < ST7789_WIDTH; iX++) {
+            uint16_t hwPixel = s_hwFrame[iY][iX];
+
+            /* expand RGB565 to RGB888 */
+            uint8_t chR = (uint8_t)((hwPixel >> 11) & 0x1F);
+            uint8_t chG = (uint8_t)((hwPixel >> 5) & 0x3F);
+            uint8_t chB = (uint8_t)(hwPixel & 0x1F);
+
+            *pchRGB++ = (uint8_t)((chR << 3) | (chR >> 2));
+            *pchRGB++ = (uint8_t)((chG << 2) | (chG >> 4));
+            *pchRGB++ = (uint8_t)((chB << 3) | (chB >> 2));
+        }
+
+        bResult = (sizeof(chLine) == fwrite(chLine, 1, sizeof(chLine), ptFile));
+    }
+
+    fclose(ptFile);
+    return bResult;
+}
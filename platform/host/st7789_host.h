@@ -0,0 +1,66 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __ST7789_HOST_H__
+#define __ST7789_HOST_H__
+
+/*============================ INCLUDES ======================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../st7789_simple.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*!
+ * \brief get the in-memory image of the LCD
+ * \return const uint16_t * ST7789_WIDTH * ST7789_HEIGHT pixels in RGB565
+ */
+extern
+const uint16_t *st7789_host_get_framebuffer(void);
+
+/*!
+ * \brief get the time the real 8-bit parallel bus would have spent on the
+ *        bytes sent so far
+ * \return uint64_t the modelled bus time in microseconds
+ */
+extern
+uint64_t st7789_host_get_bus_time_us(void);
+
+/*!
+ * \brief dump the in-memory image of the LCD to a binary PPM (P6) file
+ * \param[in] pchPath the path of the output file
+ * \retval true the image is written
+ * \retval false failed to open or write the file
+ */
+extern
+bool st7789_host_dump_ppm(const char *pchPath);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
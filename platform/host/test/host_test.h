@@ -0,0 +1,67 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * The few helpers shared by the host tests. A test is a plain executable, it
+ * returns 0 when every check passes.
+ */
+
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+/*============================ INCLUDES ======================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+/*!
+ * \brief check a condition, report the location and continue when it fails
+ */
+#define HOST_TEST_CHECK(__COND, ...)                                            \
+            do {                                                                \
+                if (!(__COND)) {                                                \
+                    g_wHostTestFailures++;                                      \
+                    printf("%s:%d: CHECK(%s) failed: ",                         \
+                            __FILE__, __LINE__, #__COND);                       \
+                    printf(__VA_ARGS__);                                        \
+                    printf("\r\n");                                             \
+                }                                                               \
+            } while(0)
+
+/*!
+ * \brief report the result of the test and return it from main()
+ */
+#define HOST_TEST_EXIT(__NAME)                                                  \
+            do {                                                                \
+                printf("[%s] %s\r\n",                                           \
+                        (0 == g_wHostTestFailures) ? "  OK  " : "FAILED",       \
+                        (__NAME));                                              \
+                return (0 == g_wHostTestFailures) ? 0 : 1;                      \
+            } while(0)
+
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+
+static uint32_t g_wHostTestFailures = 0;
+
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+
+#endif
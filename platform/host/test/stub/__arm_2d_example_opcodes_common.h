@@ -0,0 +1,28 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/* the op indexes of the example user opcodes, for host tests */
+
+#ifndef __HOST_STUB_ARM_2D_EXAMPLE_OPCODES_COMMON_H__
+#define __HOST_STUB_ARM_2D_EXAMPLE_OPCODES_COMMON_H__
+
+enum {
+    __ARM_2D_OP_IDX_USER_DRAW_LINE = 0x80,
+    __ARM_2D_OP_IDX_USER_DRAW_CIRCLE,
+};
+
+#endif
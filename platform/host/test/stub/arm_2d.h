@@ -0,0 +1,426 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * A minimal stand-in of the Arm-2D core for the host tests of the user
+ * opcodes. It provides only the types, the helpers and the op life-cycle the
+ * opcodes use, with the same names and layouts as Arm-2D. Ops are executed
+ * synchronously: __arm_2d_op_invoke() splits the target region into PFB-sized
+ * blocks and calls the SW low level io of the op for each block.
+ *
+ * It is NOT a replacement of Arm-2D, only root tiles are supported.
+ */
+
+#ifndef __HOST_STUB_ARM_2D_H__
+#define __HOST_STUB_ARM_2D_H__
+
+/*============================ INCLUDES ======================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+/*============================ MACROS ========================================*/
+
+#define __RESTRICT                  __restrict
+#define __WEAK                      __attribute__((weak))
+#define __STATIC_INLINE             static inline
+#define __STATIC_FORCEINLINE        static inline __attribute__((always_inline))
+
+/* ARM_2D_IMPL() checks ptOP against NULL even when it is declared nonnull */
+#define ARM_NONNULL(...)
+
+#define ARM_2D_UNUSED(__VAR)        (void)(__VAR)
+#define ARM_2D_PARAM(__VAR)         (void)(__VAR)
+
+#undef MAX
+#undef MIN
+#undef ABS
+#define MAX(__A, __B)               (((__A) > (__B)) ? (__A) : (__B))
+#define MIN(__A, __B)               (((__A) < (__B)) ? (__A) : (__B))
+#define ABS(__N)                    (((__N) < 0) ? -(__N) : (__N))
+#define dimof(__ARRAY)              (sizeof(__ARRAY) / sizeof((__ARRAY)[0]))
+
+#define __ARM_CONNECT2(__A, __B)                    __A##__B
+#define __ARM_CONNECT3(__A, __B, __C)               __A##__B##__C
+#define __ARM_CONNECT4(__A, __B, __C, __D)          __A##__B##__C##__D
+#define ARM_CONNECT2(__A, __B)                      __ARM_CONNECT2(__A, __B)
+#define ARM_CONNECT3(__A, __B, __C)                 __ARM_CONNECT3(__A, __B, __C)
+#define ARM_CONNECT4(__A, __B, __C, __D)            __ARM_CONNECT4(__A, __B, __C, __D)
+#define __ARM_VA_NUM_ARGS_IMPL(_1, _2, _3, _4, __N, ...)    __N
+#define __ARM_VA_NUM_ARGS(...)                              \
+            __ARM_VA_NUM_ARGS_IMPL(__VA_ARGS__, 4, 3, 2, 1)
+#define __ARM_CONNECT_N(__N)                        __ARM_CONNECT2(ARM_CONNECT, __N)
+#define ARM_CONNECT_N(__N)                          __ARM_CONNECT_N(__N)
+#define ARM_CONNECT(...)                                                        \
+            ARM_CONNECT_N(__ARM_VA_NUM_ARGS(__VA_ARGS__))(__VA_ARGS__)
+
+#undef this
+#define this                        (*ptThis)
+#define implement(__TYPE)           __TYPE use_as__##__TYPE
+
+/* the colour size, the same as Arm-2D */
+#define ARM_2D_COLOUR_SZ_8BIT       3
+#define ARM_2D_COLOUR_SZ_16BIT      4
+#define ARM_2D_COLOUR_SZ_32BIT      5
+
+#define ARM_2D_COLOUR_GRAY8         (ARM_2D_COLOUR_SZ_8BIT << 1)
+#define ARM_2D_COLOUR_RGB565        (ARM_2D_COLOUR_SZ_16BIT << 1)
+#define ARM_2D_COLOUR_CCCN888       (ARM_2D_COLOUR_SZ_32BIT << 1)
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+#define reinterpret_q16_s16(__N)    ((q16_t)(__N) * 65536)
+#define reinterpret_s16_q16(__Q16)  ((int16_t)((__Q16) >> 16))
+#define mul_n_q16(__Q16, __N)       ((q16_t)((__Q16) * (__N)))
+
+/* a NULL op uses the default op, like Arm-2D */
+#define ARM_2D_IMPL(__TYPE, __OP)                                               \
+            __TYPE *ptThis = (NULL != (__OP))                                   \
+                           ? (__TYPE *)(__OP)                                   \
+                           : (__TYPE *)g_tHostStubDefaultOP.chBuffer
+
+#define def_low_lv_io(__NAME, __SW)                                             \
+            const __arm_2d_low_level_io_t LOW_LEVEL_IO##__NAME = {              \
+                .SW = (__arm_2d_io_func_t *)(__SW),                             \
+            }
+#define ref_low_lv_io(__NAME)       &LOW_LEVEL_IO##__NAME
+
+/*
+ * the blending of a pixel with an 8-bit opacity on the unpacked channels, as
+ * Arm-2D does. 255 is opaque.
+ */
+#define __HOST_STUB_BLEND_CHANNEL(__SRC, __DES, __OPA)                          \
+            ((uint32_t)(((__SRC) * (__OPA) + (__DES) * (256 - (__OPA))) >> 8))
+
+#define __ARM_2D_PIXEL_BLENDING_OPA_GRAY8(__SRC_ADDR, __DES_ADDR, __OPA)        \
+            __host_stub_blend_gray8((__SRC_ADDR), (__DES_ADDR), (__OPA))
+#define __ARM_2D_PIXEL_BLENDING_OPA_RGB565(__SRC_ADDR, __DES_ADDR, __OPA)       \
+            __host_stub_blend_rgb565((__SRC_ADDR), (__DES_ADDR), (__OPA))
+#define __ARM_2D_PIXEL_BLENDING_OPA_CCCN888(__SRC_ADDR, __DES_ADDR, __OPA)      \
+            __host_stub_blend_cccn888((__SRC_ADDR), (__DES_ADDR), (__OPA))
+
+/* the same blending with a transparency, 256 - opacity */
+#define __ARM_2D_PIXEL_BLENDING_GRAY8(__SRC_ADDR, __DES_ADDR, __TRANS)          \
+            __host_stub_blend_gray8((__SRC_ADDR), (__DES_ADDR), 256 - (__TRANS))
+#define __ARM_2D_PIXEL_BLENDING_RGB565(__SRC_ADDR, __DES_ADDR, __TRANS)         \
+            __host_stub_blend_rgb565((__SRC_ADDR), (__DES_ADDR), 256 - (__TRANS))
+#define __ARM_2D_PIXEL_BLENDING_CCCN888(__SRC_ADDR, __DES_ADDR, __TRANS)        \
+            __host_stub_blend_cccn888((__SRC_ADDR), (__DES_ADDR), 256 - (__TRANS))
+
+/*============================ TYPES =========================================*/
+
+typedef int32_t q16_t;
+
+typedef enum {
+    arm_fsm_rt_err          = -1,
+    arm_fsm_rt_cpl          = 0,
+    arm_fsm_rt_on_going     = 1,
+    arm_fsm_rt_wait_for_obj = 2,
+    arm_fsm_rt_async        = 3,
+} arm_fsm_rt_t;
+
+/* the same as Arm-2D, the boolean results share the enum of the errors */
+typedef enum {
+    ARM_2D_ERR_INSUFFICIENT_RESOURCE = -6,
+    ARM_2D_ERR_BUSY                 = -5,
+    ARM_2D_ERR_INVALID_PARAM        = -2,
+    ARM_2D_ERR_NONE                 = 0,
+
+    ARM_2D_RT_FALSE                 = 0,
+    ARM_2D_RT_TRUE                  = 1,
+} arm_2d_err_t;
+
+typedef arm_2d_err_t arm_2d_rt_t;
+
+typedef union { uint8_t tValue; } arm_2d_color_gray8_t;
+typedef union { uint16_t tValue; } arm_2d_color_rgb565_t;
+typedef union { uint32_t tValue; } arm_2d_color_cccn888_t;
+
+typedef struct arm_2d_location_t {
+    int16_t iX;
+    int16_t iY;
+} arm_2d_location_t;
+
+typedef struct arm_2d_size_t {
+    int16_t iWidth;
+    int16_t iHeight;
+} arm_2d_size_t;
+
+typedef struct arm_2d_region_t {
+    arm_2d_location_t tLocation;
+    arm_2d_size_t tSize;
+} arm_2d_region_t;
+
+/* a root tile only */
+typedef struct arm_2d_tile_t {
+    arm_2d_region_t tRegion;
+    union {
+        uint8_t *pchBuffer;
+        uint16_t *phwBuffer;
+        uint32_t *pwBuffer;
+    };
+} arm_2d_tile_t;
+
+typedef struct __arm_2d_sub_task_t {
+    void *ptOP;
+    struct {
+        struct {
+            void *pBuffer;
+            int16_t iStride;
+            arm_2d_region_t tValidRegionInVirtualScreen;
+        } tTileProcess;
+    } Param;
+} __arm_2d_sub_task_t;
+
+typedef arm_fsm_rt_t __arm_2d_io_func_t(__arm_2d_sub_task_t *ptTask);
+
+typedef struct __arm_2d_low_level_io_t {
+    __arm_2d_io_func_t *SW;
+} __arm_2d_low_level_io_t;
+
+typedef union arm_2d_color_info_t {
+    struct {
+        uint8_t bHasAlpha   : 1;
+        uint8_t u3ColourSZ  : 3;
+        uint8_t bBigEndian  : 1;
+        uint8_t u3Variant   : 3;
+    };
+    uint8_t chScheme;
+} arm_2d_color_info_t;
+
+typedef struct __arm_2d_op_info_t {
+    struct {
+        arm_2d_color_info_t Colour;
+        struct {
+            uint8_t bHasTarget  : 1;
+        } Param;
+        uint8_t chOpIndex;
+        struct {
+            const __arm_2d_low_level_io_t *ptTileProcessLike;
+        } LowLevelIO;
+    } Info;
+} __arm_2d_op_info_t;
+
+typedef struct arm_2d_op_core_t {
+    const __arm_2d_op_info_t *ptOp;
+    bool bIsBusy;
+} arm_2d_op_core_t;
+
+typedef struct arm_2d_op_t {
+    implement(arm_2d_op_core_t);
+    struct {
+        const arm_2d_tile_t *ptTile;
+        const arm_2d_region_t *ptRegion;
+    } Target;
+} arm_2d_op_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+
+/* large enough for any user op, not every test uses it */
+__attribute__((unused))
+static union {
+    uint8_t chBuffer[1024];
+    uint64_t dwAlign;
+} g_tHostStubDefaultOP;
+
+/* the PFB used by __arm_2d_op_invoke() to split the target region */
+static arm_2d_size_t g_tHostStubPFBSize = {320, 60};
+
+/* the result of arm_2d_target_tile_is_new_frame() */
+static bool g_bHostStubIsNewFrame = true;
+
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+__STATIC_INLINE
+void __host_stub_blend_gray8(const uint8_t *pchSource, uint8_t *pchTarget, uint_fast16_t hwOpacity)
+{
+    hwOpacity += (hwOpacity == 255);
+    *pchTarget = (uint8_t)__HOST_STUB_BLEND_CHANNEL(*pchSource, *pchTarget, hwOpacity);
+}
+
+__STATIC_INLINE
+void __host_stub_blend_rgb565(const uint16_t *phwSource, uint16_t *phwTarget, uint_fast16_t hwOpacity)
+{
+    hwOpacity += (hwOpacity == 255);
+
+    uint32_t wSource = *phwSource, wTarget = *phwTarget;
+
+    /* expand to 8 bits per channel, blend, then pack again */
+    uint32_t wB = __HOST_STUB_BLEND_CHANNEL((wSource & 0x1F) << 3, (wTarget & 0x1F) << 3, hwOpacity);
+    uint32_t wG = __HOST_STUB_BLEND_CHANNEL((wSource & 0x7E0) >> 3, (wTarget & 0x7E0) >> 3, hwOpacity);
+    uint32_t wR = __HOST_STUB_BLEND_CHANNEL((wSource & 0xF800) >> 8, (wTarget & 0xF800) >> 8, hwOpacity);
+
+    *phwTarget = (uint16_t)((wB >> 3) | ((wG >> 2) << 5) | ((wR >> 3) << 11));
+}
+
+__STATIC_INLINE
+void __host_stub_blend_cccn888(const uint32_t *pwSource, uint32_t *pwTarget, uint_fast16_t hwOpacity)
+{
+    hwOpacity += (hwOpacity == 255);
+
+    uint32_t wResult = *pwTarget & 0xFF000000ul;
+    for (int n = 0; n < 24; n += 8) {
+        wResult |= __HOST_STUB_BLEND_CHANNEL(   (*pwSource >> n) & 0xFF,
+                                                (*pwTarget >> n) & 0xFF,
+                                                hwOpacity) << n;
+    }
+    *pwTarget = wResult;
+}
+
+__STATIC_INLINE
+bool arm_2d_region_intersect(   const arm_2d_region_t *ptRegionIn0,
+                                const arm_2d_region_t *ptRegionIn1,
+                                arm_2d_region_t *ptRegionOut)
+{
+    int32_t nX0 = MAX(ptRegionIn0->tLocation.iX, ptRegionIn1->tLocation.iX);
+    int32_t nY0 = MAX(ptRegionIn0->tLocation.iY, ptRegionIn1->tLocation.iY);
+    int32_t nX1 = MIN(  ptRegionIn0->tLocation.iX + ptRegionIn0->tSize.iWidth,
+                        ptRegionIn1->tLocation.iX + ptRegionIn1->tSize.iWidth);
+    int32_t nY1 = MIN(  ptRegionIn0->tLocation.iY + ptRegionIn0->tSize.iHeight,
+                        ptRegionIn1->tLocation.iY + ptRegionIn1->tSize.iHeight);
+
+    if (nX1 <= nX0 || nY1 <= nY0) {
+        return false;
+    }
+
+    if (NULL != ptRegionOut) {
+        *ptRegionOut = (arm_2d_region_t) {
+            .tLocation = {(int16_t)nX0, (int16_t)nY0},
+            .tSize = {(int16_t)(nX1 - nX0), (int16_t)(nY1 - nY0)},
+        };
+    }
+    return true;
+}
+
+__STATIC_INLINE
+void arm_2d_region_get_minimal_enclosure(   const arm_2d_region_t *ptInput0,
+                                            const arm_2d_region_t *ptInput1,
+                                            arm_2d_region_t *ptOutput)
+{
+    int32_t nX0 = MIN(ptInput0->tLocation.iX, ptInput1->tLocation.iX);
+    int32_t nY0 = MIN(ptInput0->tLocation.iY, ptInput1->tLocation.iY);
+    int32_t nX1 = MAX(  ptInput0->tLocation.iX + ptInput0->tSize.iWidth,
+                        ptInput1->tLocation.iX + ptInput1->tSize.iWidth);
+    int32_t nY1 = MAX(  ptInput0->tLocation.iY + ptInput0->tSize.iHeight,
+                        ptInput1->tLocation.iY + ptInput1->tSize.iHeight);
+
+    *ptOutput = (arm_2d_region_t) {
+        .tLocation = {(int16_t)nX0, (int16_t)nY0},
+        .tSize = {(int16_t)(nX1 - nX0), (int16_t)(nY1 - nY0)},
+    };
+}
+
+__STATIC_INLINE
+bool arm_2d_is_point_inside_region( const arm_2d_region_t *ptRegion,
+                                    const arm_2d_location_t *ptPoint)
+{
+    return  ptPoint->iX >= ptRegion->tLocation.iX
+        &&  ptPoint->iY >= ptRegion->tLocation.iY
+        &&  ptPoint->iX < ptRegion->tLocation.iX + ptRegion->tSize.iWidth
+        &&  ptPoint->iY < ptRegion->tLocation.iY + ptRegion->tSize.iHeight;
+}
+
+/* a root tile is the virtual screen */
+__STATIC_INLINE
+arm_2d_location_t arm_2d_get_absolute_location( const arm_2d_tile_t *ptTile,
+                                                arm_2d_location_t tLocation,
+                                                bool bOnVirtualScreen)
+{
+    ARM_2D_UNUSED(ptTile);
+    ARM_2D_UNUSED(bOnVirtualScreen);
+    return tLocation;
+}
+
+__STATIC_INLINE
+arm_2d_rt_t arm_2d_target_tile_is_new_frame(const arm_2d_tile_t *ptTarget)
+{
+    ARM_2D_UNUSED(ptTarget);
+    return g_bHostStubIsNewFrame ? ARM_2D_RT_TRUE : ARM_2D_RT_FALSE;
+}
+
+__STATIC_INLINE
+bool arm_2d_op_wait_async(arm_2d_op_core_t *ptOP)
+{
+    ARM_2D_UNUSED(ptOP);
+    return true;
+}
+
+__STATIC_INLINE
+bool __arm_2d_op_acquire(arm_2d_op_core_t *ptOP)
+{
+    assert(!ptOP->bIsBusy);
+    ptOP->bIsBusy = true;
+    return true;
+}
+
+__STATIC_INLINE
+arm_fsm_rt_t __arm_2d_op_depose(arm_2d_op_core_t *ptOP, arm_fsm_rt_t tResult)
+{
+    ptOP->bIsBusy = false;
+    return tResult;
+}
+
+/*!
+ * \brief run the SW low level io of an op on every PFB of the target region
+ */
+__STATIC_INLINE
+arm_fsm_rt_t __arm_2d_op_invoke(arm_2d_op_core_t *ptOP)
+{
+    arm_2d_op_t *ptThis = (arm_2d_op_t *)ptOP;
+    const arm_2d_tile_t *ptTile = this.Target.ptTile;
+    const __arm_2d_op_info_t *ptInfo = ptOP->ptOp;
+    size_t tPixelSize = (size_t)1 << (ptInfo->Info.Colour.u3ColourSZ - 3);
+
+    arm_2d_region_t tRegion = ptTile->tRegion;
+    if (NULL != this.Target.ptRegion) {
+        if (!arm_2d_region_intersect(&tRegion, this.Target.ptRegion, &tRegion)) {
+            return __arm_2d_op_depose(ptOP, arm_fsm_rt_cpl);
+        }
+    }
+
+    for (int16_t iY = 0; iY < ptTile->tRegion.tSize.iHeight; iY += g_tHostStubPFBSize.iHeight) {
+        for (int16_t iX = 0; iX < ptTile->tRegion.tSize.iWidth; iX += g_tHostStubPFBSize.iWidth) {
+            arm_2d_region_t tPFB = {
+                .tLocation = {iX, iY},
+                .tSize = g_tHostStubPFBSize,
+            };
+
+            __arm_2d_sub_task_t tTask = {.ptOP = ptOP};
+            arm_2d_region_t *ptValid = &tTask.Param.tTileProcess.tValidRegionInVirtualScreen;
+
+            if (!arm_2d_region_intersect(&tPFB, &tRegion, ptValid)) {
+                continue;
+            }
+
+            tTask.Param.tTileProcess.iStride = ptTile->tRegion.tSize.iWidth;
+            tTask.Param.tTileProcess.pBuffer
+                = ptTile->pchBuffer
+                + ((size_t)ptValid->tLocation.iY * (size_t)ptTile->tRegion.tSize.iWidth
+                + (size_t)ptValid->tLocation.iX) * tPixelSize;
+
+            ptInfo->Info.LowLevelIO.ptTileProcessLike->SW(&tTask);
+        }
+    }
+
+    return __arm_2d_op_depose(ptOP, arm_fsm_rt_cpl);
+}
+
+#endif
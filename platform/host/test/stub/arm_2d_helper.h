@@ -0,0 +1,36 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/* the part of the Arm-2D helper used by the user opcodes, for host tests */
+
+#ifndef __HOST_STUB_ARM_2D_HELPER_H__
+#define __HOST_STUB_ARM_2D_HELPER_H__
+
+#include "arm_2d.h"
+
+/*!
+ * \brief mix two opacities, 255 is opaque
+ */
+__STATIC_INLINE
+uint8_t arm_2d_helper_alpha_mix(uint_fast16_t hwAlpha0, uint_fast16_t hwAlpha1)
+{
+    hwAlpha0 += (hwAlpha0 == 255);
+    hwAlpha1 += (hwAlpha1 == 255);
+    return (uint8_t)MIN((hwAlpha0 * hwAlpha1) >> 8, 255);
+}
+
+#endif
@@ -0,0 +1,209 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * Checks __arm_2d_user_rgb565_fill_span_opa() against the same 1/32 opacity
+ * maths done one pixel and one channel at a time, then measures it against
+ * the per-pixel 8-bit blending of Arm-2D.
+ *
+ * The numbers of the benchmark come from the host CPU, they only show the
+ * trend. Run build/test_rgb565_fill_span to see them.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include <stdlib.h>
+#include <time.h>
+
+#include "host_test.h"
+#include "__arm_2d_user_opcode_rgb565.h"
+
+/*============================ MACROS ========================================*/
+
+#define TEST_BUFFER_SIZE        400
+#define TEST_ITERATIONS         100000
+
+/* the 8-bit blending truncates, the 1/32 opacity is rounded */
+#define TEST_MAX_CHANNEL_DIFF   1
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief the same 1/32 opacity maths, one pixel and one channel at a time
+ */
+static void __model_fill_span_opa(  uint16_t *phwTarget,
+                                    int32_t nCount,
+                                    uint16_t hwColour,
+                                    uint8_t chOpacity)
+{
+    uint32_t wOpacity = ((uint32_t)chOpacity + 4) >> 3;
+
+    if (0 == wOpacity) {
+        return ;
+    }
+
+    for (; nCount > 0; nCount--, phwTarget++) {
+        static const uint8_t c_chShift[3] = {0, 5, 11};
+        static const uint8_t c_chMask[3] = {0x1F, 0x3F, 0x1F};
+        uint32_t wResult = 0;
+
+        for (int32_t n = 0; n < 3; n++) {
+            uint32_t wSource = (hwColour >> c_chShift[n]) & c_chMask[n];
+            uint32_t wTarget = (*phwTarget >> c_chShift[n]) & c_chMask[n];
+
+            wResult |= ((wSource * wOpacity + wTarget * (32 - wOpacity)) >> 5)
+                    << c_chShift[n];
+        }
+        *phwTarget = (uint16_t)wResult;
+    }
+}
+
+/*!
+ * \brief the per-pixel blending of Arm-2D
+ */
+__attribute__((noinline))
+static void __ref_fill_span_opa(uint16_t *phwTarget,
+                                int32_t nCount,
+                                uint16_t hwColour,
+                                uint8_t chOpacity)
+{
+    while (nCount-- > 0) {
+        __ARM_2D_PIXEL_BLENDING_OPA_RGB565(&hwColour, phwTarget++, chOpacity);
+    }
+}
+
+__attribute__((noinline))
+static void __new_fill_span_opa(uint16_t *phwTarget,
+                                int32_t nCount,
+                                uint16_t hwColour,
+                                uint8_t chOpacity)
+{
+    __arm_2d_user_rgb565_fill_span_opa(phwTarget, nCount, hwColour, chOpacity);
+}
+
+static uint32_t __rgb565_channel_diff(uint16_t hwA, uint16_t hwB)
+{
+    uint32_t wB = (uint32_t)abs((hwA & 0x1F) - (hwB & 0x1F));
+    uint32_t wG = (uint32_t)abs(((hwA >> 5) & 0x3F) - ((hwB >> 5) & 0x3F));
+    uint32_t wR = (uint32_t)abs((hwA >> 11) - (hwB >> 11));
+
+    return MAX(wR, MAX(wG, wB));
+}
+
+static double __now(void)
+{
+    struct timespec tNow;
+    clock_gettime(CLOCK_MONOTONIC, &tNow);
+    return (double)tNow.tv_sec + (double)tNow.tv_nsec * 1e-9;
+}
+
+static void __benchmark(void)
+{
+    static uint16_t s_hwBuffer[TEST_BUFFER_SIZE];
+    static const int32_t c_nLength[] = {1, 2, 4, 8, 16, 32, 64, 128, 320};
+
+    printf("%8s %16s %16s %8s\r\n", "pixels", "per-pixel (ns)", "span (ns)", "ratio");
+
+    for (int32_t n = 0; n < (int32_t)dimof(c_nLength); n++) {
+        int32_t nCount = c_nLength[n];
+        int32_t nRepeat = 4000000 / (nCount + 4);
+
+        /* both aligned and unaligned spans, with opacities in 1 ~ 251 */
+        double dfStart = __now();
+        for (int32_t r = 0; r < nRepeat; r++) {
+            __ref_fill_span_opa(&s_hwBuffer[r & 1], nCount, 0x1234, (uint8_t)(100 + (r & 7)));
+        }
+        double dfPerPixel = __now() - dfStart;
+
+        dfStart = __now();
+        for (int32_t r = 0; r < nRepeat; r++) {
+            __new_fill_span_opa(&s_hwBuffer[r & 1], nCount, 0x1234, (uint8_t)(100 + (r & 7)));
+        }
+        double dfSpan = __now() - dfStart;
+
+        printf("%8d %16.1f %16.1f %7.2fx\r\n",
+                nCount,
+                dfPerPixel / nRepeat * 1e9,
+                dfSpan / nRepeat * 1e9,
+                dfPerPixel / dfSpan);
+    }
+}
+
+int main(void)
+{
+    static uint16_t s_hwSpan[TEST_BUFFER_SIZE];
+    static uint16_t s_hwModel[TEST_BUFFER_SIZE];
+    static uint16_t s_hwReference[TEST_BUFFER_SIZE];
+
+    srand(2040);
+
+    for (int32_t n = 0; n < TEST_ITERATIONS; n++) {
+        int32_t nOffset = rand() % 8;
+        int32_t nCount = rand() % 321;
+        uint16_t hwColour = (uint16_t)rand();
+        uint8_t chOpacity = (uint8_t)rand();
+
+        for (int32_t i = 0; i < TEST_BUFFER_SIZE; i++) {
+            s_hwSpan[i] = (uint16_t)rand();
+        }
+        memcpy(s_hwModel, s_hwSpan, sizeof(s_hwSpan));
+        memcpy(s_hwReference, s_hwSpan, sizeof(s_hwSpan));
+
+        __new_fill_span_opa(&s_hwSpan[nOffset], nCount, hwColour, chOpacity);
+        __model_fill_span_opa(&s_hwModel[nOffset], nCount, hwColour, chOpacity);
+        __ref_fill_span_opa(&s_hwReference[nOffset], nCount, hwColour, chOpacity);
+
+        /* the same pixels as the model, nothing outside of the span changes */
+        HOST_TEST_CHECK(0 == memcmp(s_hwSpan, s_hwModel, sizeof(s_hwSpan)),
+                        "offset %d count %d opacity %d: differs from the model",
+                        nOffset, nCount, chOpacity);
+
+        /* the 1/32 opacity is close to the 8-bit blending within the rounding */
+        if (chOpacity >= 4 && chOpacity < 252) {
+            uint32_t wMaxDiff = 0;
+            for (int32_t i = nOffset; i < nOffset + nCount; i++) {
+                wMaxDiff = MAX(wMaxDiff, __rgb565_channel_diff(s_hwSpan[i], s_hwReference[i]));
+            }
+            HOST_TEST_CHECK(wMaxDiff <= TEST_MAX_CHANNEL_DIFF,
+                            "opacity %d: %u LSB from the 8-bit blending",
+                            chOpacity, wMaxDiff);
+        }
+    }
+
+    /* the opacity thresholds documented at __API_SPAN_BLENDING_OPA */
+    for (uint32_t wOpacity = 0; wOpacity < 256; wOpacity++) {
+        uint16_t hwPixel = 0x0000;
+        __new_fill_span_opa(&hwPixel, 1, 0xFFFF, (uint8_t)wOpacity);
+
+        if (wOpacity < 4) {
+            HOST_TEST_CHECK(0x0000 == hwPixel, "opacity %u draws", wOpacity);
+        } else if (wOpacity >= 252) {
+            HOST_TEST_CHECK(0xFFFF == hwPixel, "opacity %u isn't opaque", wOpacity);
+        } else {
+            HOST_TEST_CHECK(0x0000 != hwPixel && 0xFFFF != hwPixel,
+                            "opacity %u: 0x%04x", wOpacity, hwPixel);
+        }
+    }
+
+    __benchmark();
+
+    HOST_TEST_EXIT("rgb565 fill span");
+}
@@ -0,0 +1,238 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * Stress the lock-free spsc queue with a producer thread and a consumer
+ * thread, in the way core0 and core1 use it: every item must arrive once, in
+ * order and intact, across many wrap-arounds of the 16-bit indexes.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include "host_test.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include "spsc_queue.c"
+
+/*============================ MACROS ========================================*/
+
+/* more than 2^16 items to wrap the free-running indexes several times */
+#define TEST_SPSC_ITEM_COUNT        1000000ul
+
+/* as small as the PFB pool, so both sides hit the full and the empty queue */
+#define TEST_SPSC_QUEUE_SIZE        4
+
+/* spin for a while before giving up the CPU, like __WFE() on the target */
+#define TEST_SPSC_SPIN_COUNT        256
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/* an odd size, so a torn copy is likely to break the checksum */
+typedef struct test_item_t {
+    uint32_t wSequence;
+    uint8_t chPayload[11];
+    uint8_t chChecksum;
+} test_item_t;
+
+typedef struct test_context_t {
+    spsc_queue_t tQueue;
+    test_item_t tBuffer[TEST_SPSC_QUEUE_SIZE];
+    uint32_t wProducerFullCount;        /* spins on a full queue */
+    uint32_t wConsumerEmptyCount;       /* spins on an empty queue */
+    uint32_t wErrorCount;
+    uint32_t wLastSequence;
+} test_context_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+static void __test_wait(uint32_t *pwCounter)
+{
+    if (0 == (++(*pwCounter) % TEST_SPSC_SPIN_COUNT)) {
+        sched_yield();
+    }
+}
+
+static uint8_t __test_checksum(const test_item_t *ptItem)
+{
+    uint8_t chSum = (uint8_t)ptItem->wSequence;
+    for (size_t n = 0; n < sizeof(ptItem->chPayload); n++) {
+        chSum = (uint8_t)(chSum * 31 + ptItem->chPayload[n]);
+    }
+    return chSum;
+}
+
+static void *__test_producer(void *pArg)
+{
+    test_context_t *ptContext = (test_context_t *)pArg;
+
+    for (uint32_t wSequence = 0; wSequence < TEST_SPSC_ITEM_COUNT; wSequence++) {
+        test_item_t tItem = {.wSequence = wSequence};
+        for (size_t n = 0; n < sizeof(tItem.chPayload); n++) {
+            tItem.chPayload[n] = (uint8_t)(wSequence >> (n & 3) * 8) ^ (uint8_t)n;
+        }
+        tItem.chChecksum = __test_checksum(&tItem);
+
+        while(!spsc_queue_push(&ptContext->tQueue, &tItem)) {
+            __test_wait(&ptContext->wProducerFullCount);
+        }
+    }
+
+    return NULL;
+}
+
+static void *__test_consumer(void *pArg)
+{
+    test_context_t *ptContext = (test_context_t *)pArg;
+
+    for (uint32_t wExpected = 0; wExpected < TEST_SPSC_ITEM_COUNT; wExpected++) {
+        test_item_t tItem;
+
+        while(!spsc_queue_pop(&ptContext->tQueue, &tItem)) {
+            __test_wait(&ptContext->wConsumerEmptyCount);
+        }
+
+        if (    tItem.wSequence != wExpected
+            ||  tItem.chChecksum != __test_checksum(&tItem)) {
+            if (ptContext->wErrorCount++ < 8) {
+                printf("expected item %u, got %u (checksum %s)\r\n",
+                        (unsigned)wExpected,
+                        (unsigned)tItem.wSequence,
+                        tItem.chChecksum == __test_checksum(&tItem)
+                            ? "ok" : "broken");
+            }
+        }
+        ptContext->wLastSequence = tItem.wSequence;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    static test_context_t s_tContext;
+
+    spsc_queue_init(&s_tContext.tQueue,
+                    s_tContext.tBuffer,
+                    sizeof(test_item_t),
+                    TEST_SPSC_QUEUE_SIZE);
+
+    /* single thread: full and empty */
+    do {
+        test_item_t tItem = {0};
+        for (size_t n = 0; n < TEST_SPSC_QUEUE_SIZE; n++) {
+            tItem.wSequence = (uint32_t)n;
+            HOST_TEST_CHECK(spsc_queue_push(&s_tContext.tQueue, &tItem),
+                            "push %u failed",
+                            (unsigned)n);
+        }
+        HOST_TEST_CHECK(!spsc_queue_push(&s_tContext.tQueue, &tItem),
+                        "push to a full queue");
+        HOST_TEST_CHECK(TEST_SPSC_QUEUE_SIZE
+                            == spsc_queue_get_count(&s_tContext.tQueue),
+                        "wrong count");
+
+        for (size_t n = 0; n < TEST_SPSC_QUEUE_SIZE; n++) {
+            HOST_TEST_CHECK(spsc_queue_pop(&s_tContext.tQueue, &tItem)
+                        &&  n == tItem.wSequence,
+                            "pop %u failed",
+                            (unsigned)n);
+        }
+        HOST_TEST_CHECK(!spsc_queue_pop(&s_tContext.tQueue, &tItem),
+                        "pop from an empty queue");
+        HOST_TEST_CHECK(0 == spsc_queue_get_count(&s_tContext.tQueue),
+                        "wrong count");
+    } while(0);
+
+    /* single thread: full and empty across the wrap-around of the indexes,
+     * an off-by-one in the full check (e.g. > instead of >=, or the 
+     * difference of the indexes without the 16-bit cast) fails here 
+     */
+    for (uint32_t wStart = 0xFFFFul - TEST_SPSC_QUEUE_SIZE; 
+        wStart <= 0xFFFFul + 1; 
+        wStart++) {
+        test_item_t tItem = {0};
+        s_tContext.tQueue.hwHead = (uint16_t)wStart;
+        s_tContext.tQueue.hwTail = (uint16_t)wStart;
+
+        for (size_t n = 0; n < TEST_SPSC_QUEUE_SIZE; n++) {
+            tItem.wSequence = (uint32_t)n;
+            HOST_TEST_CHECK(spsc_queue_push(&s_tContext.tQueue, &tItem),
+                            "push %u from 0x%04x failed",
+                            (unsigned)n,
+                            (unsigned)wStart);
+            HOST_TEST_CHECK(n + 1 == spsc_queue_get_count(&s_tContext.tQueue),
+                            "wrong count from 0x%04x",
+                            (unsigned)wStart);
+        }
+        HOST_TEST_CHECK(!spsc_queue_push(&s_tContext.tQueue, &tItem),
+                        "push to a full queue from 0x%04x",
+                        (unsigned)wStart);
+
+        for (size_t n = 0; n < TEST_SPSC_QUEUE_SIZE; n++) {
+            HOST_TEST_CHECK(spsc_queue_pop(&s_tContext.tQueue, &tItem)
+                        &&  n == tItem.wSequence,
+                            "pop %u from 0x%04x failed",
+                            (unsigned)n,
+                            (unsigned)wStart);
+        }
+        HOST_TEST_CHECK(!spsc_queue_pop(&s_tContext.tQueue, &tItem),
+                        "pop from an empty queue from 0x%04x",
+                        (unsigned)wStart);
+    }
+
+    if (g_wHostTestFailures > 0) {
+        /* the threads might never finish with a broken queue */
+        HOST_TEST_EXIT("spsc_queue");
+    }
+
+    /* the threads start from an empty queue at index 0 */
+    spsc_queue_init(&s_tContext.tQueue,
+                    s_tContext.tBuffer,
+                    sizeof(test_item_t),
+                    TEST_SPSC_QUEUE_SIZE);
+
+    /* two threads */
+    pthread_t tProducer, tConsumer;
+    pthread_create(&tConsumer, NULL, &__test_consumer, &s_tContext);
+    pthread_create(&tProducer, NULL, &__test_producer, &s_tContext);
+    pthread_join(tProducer, NULL);
+    pthread_join(tConsumer, NULL);
+
+    HOST_TEST_CHECK(0 == s_tContext.wErrorCount,
+                    "%u items are lost, duplicated or torn",
+                    (unsigned)s_tContext.wErrorCount);
+    HOST_TEST_CHECK(TEST_SPSC_ITEM_COUNT - 1 == s_tContext.wLastSequence,
+                    "the last item is %u",
+                    (unsigned)s_tContext.wLastSequence);
+    HOST_TEST_CHECK(0 == spsc_queue_get_count(&s_tContext.tQueue),
+                    "%u items left",
+                    (unsigned)spsc_queue_get_count(&s_tContext.tQueue));
+
+    printf( "%lu items, the producer spun %u times on a full queue, "
+            "the consumer spun %u times on an empty queue\r\n",
+            TEST_SPSC_ITEM_COUNT,
+            (unsigned)s_tContext.wProducerFullCount,
+            (unsigned)s_tContext.wConsumerEmptyCount);
+
+    HOST_TEST_EXIT("spsc_queue");
+}
@@ -0,0 +1,141 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * Test the host stand-in of the LCD driver: the in-memory image, the modelled
+ * bus time, the completion of the asynchronous flushing and the PPM dump.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "st7789_host.c"
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+static volatile uint32_t s_wFlushCompleteCount = 0;
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+void st7789_insert_async_flush_cpl_evt_handler(void)
+{
+    s_wFlushCompleteCount++;
+}
+
+int main(void)
+{
+    static uint16_t s_hwBlock[60][320];
+
+    st7789_init();
+
+    for (int iY = 0; iY < 60; iY++) {
+        for (int iX = 0; iX < 320; iX++) {
+            s_hwBlock[iY][iX] = (uint16_t)(iY * 320 + iX);
+        }
+    }
+
+    /* a full-width block, the blocking draw returns after the transfer */
+    int64_t lStart = __st7789_host_now_ns();
+    st7789_draw_bitmap(0, 120, 320, 60, (const uint8_t *)s_hwBlock);
+    int64_t lElapsed = __st7789_host_now_ns() - lStart;
+    int64_t lExpected = __st7789_host_get_transfer_ns(320 * 60 * 2 + 11);
+    HOST_TEST_CHECK(lElapsed >= lExpected,
+                    "the blocking draw took %lld ns, the bus needs %lld ns",
+                    (long long)lElapsed,
+                    (long long)lExpected);
+
+    const uint16_t *phwFrame = st7789_host_get_framebuffer();
+    HOST_TEST_CHECK(0 == memcmp(&phwFrame[120 * ST7789_WIDTH],
+                                s_hwBlock,
+                                sizeof(s_hwBlock)),
+                    "the block is not copied into the frame");
+    HOST_TEST_CHECK(0 == phwFrame[119 * ST7789_WIDTH + 319]
+                &&  0 == phwFrame[180 * ST7789_WIDTH],
+                    "pixels outside the block are touched");
+
+    /* a small block uses the stride of its own width */
+    st7789_draw_bitmap_async(10, 20, 4, 3, (const uint8_t *)s_hwBlock);
+    HOST_TEST_CHECK(s_hwBlock[0][4] == phwFrame[21 * ST7789_WIDTH + 10],
+                    "wrong stride of the source");
+    while (0 == s_wFlushCompleteCount);
+
+    /* the flush-complete event comes when the bus would be done */
+    lStart = __st7789_host_now_ns();
+    st7789_draw_bitmap_async(0, 0, 320, 60, (const uint8_t *)s_hwBlock);
+    HOST_TEST_CHECK(1 == s_wFlushCompleteCount,
+                    "the flushing completes before the transfer");
+    while (1 == s_wFlushCompleteCount);
+    lElapsed = __st7789_host_now_ns() - lStart;
+    HOST_TEST_CHECK(2 == s_wFlushCompleteCount,
+                    "%u flush-complete events",
+                    (unsigned)s_wFlushCompleteCount);
+    HOST_TEST_CHECK(lElapsed >= lExpected,
+                    "the async flushing took %lld ns, the bus needs %lld ns",
+                    (long long)lElapsed,
+                    (long long)lExpected);
+
+    /* 3 blocks, each with 11 bytes of commands, 3 PIO cycles per byte */
+    uint64_t dwBytes = 320 * 60 * 2 * 2 + 4 * 3 * 2 + 3 * 11;
+    HOST_TEST_CHECK(st7789_host_get_bus_time_us()
+                        == dwBytes * 3ull * 1000000ull / 62500000ull,
+                    "bus time %llu us",
+                    (unsigned long long)st7789_host_get_bus_time_us());
+
+    /* the PPM dump */
+    do {
+        char chPath[] = "/tmp/test_st7789_host_XXXXXX";
+        int nFile = mkstemp(chPath);
+        HOST_TEST_CHECK(nFile >= 0, "failed to create %s", chPath);
+        if (nFile < 0) {
+            break;
+        }
+        close(nFile);
+
+        HOST_TEST_CHECK(st7789_host_dump_ppm(chPath), "failed to dump");
+
+        FILE *ptFile = fopen(chPath, "rb");
+        int nWidth = 0, nHeight = 0, nMax = 0;
+        HOST_TEST_CHECK(3 == fscanf(ptFile, "P6 %d %d %d", &nWidth, &nHeight, &nMax)
+                    &&  ST7789_WIDTH == nWidth
+                    &&  ST7789_HEIGHT == nHeight
+                    &&  255 == nMax,
+                        "wrong PPM header");
+        fgetc(ptFile);
+
+        /* pixel (1, 120) is 0x0001, i.e. the lowest blue */
+        uint8_t chRGB[3];
+        fseek(ptFile, (long)(120 * ST7789_WIDTH + 1) * 3, SEEK_CUR);
+        HOST_TEST_CHECK(3 == fread(chRGB, 1, 3, ptFile)
+                    &&  0 == chRGB[0] && 0 == chRGB[1] && 0x08 == chRGB[2],
+                        "wrong pixel %02x%02x%02x",
+                        chRGB[0], chRGB[1], chRGB[2]);
+
+        fclose(ptFile);
+        remove(chPath);
+    } while(0);
+
+    HOST_TEST_EXIT("st7789_host");
+}
@@ -0,0 +1,654 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * Compares the RGB565 circle op with the original per-pixel kernel, which
+ * blends every pixel inside the radius and, with anti-alias, the pixels in
+ * the one-pixel band outside it by the fraction of the distance. The spans
+ * round the opacity to 1/32 and the distance is an integer square root, so
+ * each channel may differ by up to two LSBs.
+ *
+ * The gray8 and cccn888 ops come from the same template. A cccn888 circle on
+ * a gray background must match the gray8 one in every channel, and a white
+ * gray8 circle on black must have the coverage of the RGB565 one.
+ *
+ * A batch of circles drawn by one op must produce the same pixels as the
+ * circles drawn one by one in the order of the array.
+ *
+ * The arc op splits each row into spans by the radii and the sides. It is
+ * compared with a per-pixel kernel, which takes the coverage of the ring
+ * from a float distance and the sides from the sines rounded to Q14.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include <stdlib.h>
+#include <math.h>
+
+#include "host_test.h"
+#include "arm_2d_user_opcode_draw_circle.c"
+
+/*============================ MACROS ========================================*/
+
+#define TEST_SCREEN_WIDTH       320
+#define TEST_SCREEN_HEIGHT      240
+
+/* the largest difference of a channel, in the LSBs of the channel */
+#define TEST_MAX_CHANNEL_DIFF   2
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+static uint16_t s_hwScreen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+static uint16_t s_hwReference[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+static uint8_t s_chGray8Screen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+static uint32_t s_wCCCN888Screen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+
+static const arm_2d_tile_t c_tScreen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+    .phwBuffer = &s_hwScreen[0][0],
+};
+
+static const arm_2d_tile_t c_tGray8Screen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+    .pchBuffer = &s_chGray8Screen[0][0],
+};
+
+static const arm_2d_tile_t c_tCCCN888Screen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+    .pwBuffer = &s_wCCCN888Screen[0][0],
+};
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief the original kernel, one pixel at a time with a float square root
+ */
+static void __ref_draw_circle(  const arm_2d_region_t *ptRegion,
+                                arm_2d_location_t tPivot,
+                                int16_t iRadius,
+                                bool bAntiAlias,
+                                uint16_t hwColour,
+                                uint8_t chOpacity)
+{
+    arm_2d_region_t tDrawRegion = {
+        .tLocation = {
+            (int16_t)(tPivot.iX - iRadius - 1),
+            (int16_t)(tPivot.iY - iRadius - 1),
+        },
+        .tSize = {
+            (int16_t)(iRadius * 2 + 4),
+            (int16_t)(iRadius * 2 + 2),
+        },
+    };
+
+    if (!arm_2d_region_intersect(ptRegion, &tDrawRegion, &tDrawRegion)
+    ||  !arm_2d_region_intersect(&c_tScreen.tRegion, &tDrawRegion, &tDrawRegion)) {
+        return ;
+    }
+
+    uint32_t wRadius2 = (uint32_t)iRadius * (uint32_t)iRadius;
+    uint32_t wRadiusBorder2 = (uint32_t)(iRadius + 1) * (uint32_t)(iRadius + 1);
+
+    for (int32_t iY = tDrawRegion.tLocation.iY;
+        iY < tDrawRegion.tLocation.iY + tDrawRegion.tSize.iHeight;
+        iY++) {
+        for (int32_t iX = tDrawRegion.tLocation.iX;
+            iX < tDrawRegion.tLocation.iX + tDrawRegion.tSize.iWidth;
+            iX++) {
+
+            uint32_t wXOffset = (uint32_t)ABS(iX - tPivot.iX);
+            uint32_t wYOffset = (uint32_t)ABS(iY - tPivot.iY);
+            uint32_t wDistance2 = wXOffset * wXOffset + wYOffset * wYOffset;
+            uint16_t *phwPixel = &s_hwReference[iY][iX];
+
+            if (wDistance2 >= wRadiusBorder2) {
+                continue;
+            } else if (wDistance2 <= wRadius2) {
+                __ARM_2D_PIXEL_BLENDING_OPA_RGB565(&hwColour, phwPixel, chOpacity);
+                continue;
+            } else if (!bAntiAlias) {
+                continue;
+            }
+
+            q16_t q16Fraction = (q16_t)(sqrt((double)wDistance2) * 65536.0)
+                              - reinterpret_q16_s16(iRadius);
+            uint16_t hwOpacity = (q16Fraction & 0xFF00) >> 8;
+
+            __ARM_2D_PIXEL_BLENDING_OPA_RGB565(
+                &hwColour,
+                phwPixel,
+                arm_2d_helper_alpha_mix(0xFF - hwOpacity, chOpacity));
+        }
+    }
+}
+
+/*!
+ * \brief sin() of an angle in degrees, rounded to Q14
+ */
+static int32_t __ref_sin_q14(int32_t nAngle)
+{
+    return (int32_t)lround(sin((double)nAngle * M_PI / 180.0) * 16384.0);
+}
+
+/*!
+ * \brief the per-pixel arc, the coverage of the ring and of the sides are
+ *        calculated for every pixel of the bounding box
+ */
+static void __ref_draw_arc( const arm_2d_region_t *ptRegion,
+                            arm_2d_location_t tPivot,
+                            int16_t iInnerRadius,
+                            int16_t iOuterRadius,
+                            int16_t iStartAngle,
+                            int16_t iEndAngle,
+                            bool bAntiAlias,
+                            uint16_t hwColour,
+                            uint8_t chOpacity)
+{
+    int32_t nSweep = (int32_t)iEndAngle - (int32_t)iStartAngle;
+    bool bIsRing = (nSweep >= 360);
+
+    if (!bIsRing) {
+        nSweep = ((nSweep % 360) + 360) % 360;
+        if (0 == nSweep) {
+            return ;
+        }
+    }
+
+    /* the inner normals of the start side and the end side, Q14 */
+    int32_t nEndAngle = iStartAngle + nSweep;
+    int32_t nA[2] = {-__ref_sin_q14(iStartAngle), __ref_sin_q14(nEndAngle)};
+    int32_t nB[2] = {__ref_sin_q14(iStartAngle + 90), -__ref_sin_q14(nEndAngle + 90)};
+
+    arm_2d_region_t tDrawRegion = {
+        .tLocation = {
+            (int16_t)(tPivot.iX - iOuterRadius - 1),
+            (int16_t)(tPivot.iY - iOuterRadius - 1),
+        },
+        .tSize = {
+            (int16_t)(iOuterRadius * 2 + 3),
+            (int16_t)(iOuterRadius * 2 + 3),
+        },
+    };
+
+    if (!arm_2d_region_intersect(ptRegion, &tDrawRegion, &tDrawRegion)
+    ||  !arm_2d_region_intersect(&c_tScreen.tRegion, &tDrawRegion, &tDrawRegion)) {
+        return ;
+    }
+
+    int32_t nInner = iInnerRadius;
+    int32_t nOuter = iOuterRadius;
+
+    for (int32_t iY = tDrawRegion.tLocation.iY;
+        iY < tDrawRegion.tLocation.iY + tDrawRegion.tSize.iHeight;
+        iY++) {
+        for (int32_t iX = tDrawRegion.tLocation.iX;
+            iX < tDrawRegion.tLocation.iX + tDrawRegion.tSize.iWidth;
+            iX++) {
+
+            int32_t nX = iX - tPivot.iX;
+            int32_t nY = iY - tPivot.iY;
+            int32_t nDistance2 = nX * nX + nY * nY;
+            int32_t nDistanceQ8 = (int32_t)(sqrt((double)nDistance2) * 256.0);
+            int32_t nCoverage = 255;
+
+            if (!bAntiAlias) {
+                if (nDistance2 > nOuter * nOuter || nDistance2 < nInner * nInner) {
+                    continue;
+                }
+            } else {
+                if (nDistance2 >= (nOuter + 1) * (nOuter + 1)) {
+                    continue;
+                } else if (nDistance2 > nOuter * nOuter) {
+                    nCoverage = 0xFF - ((nDistanceQ8 - nOuter * 256) & 0xFF);
+                }
+
+                if (nDistance2 < nInner * nInner) {
+                    if (nDistance2 <= (nInner - 1) * (nInner - 1)) {
+                        continue;
+                    }
+                    nCoverage = MIN(nCoverage, 
+                                    MIN(nDistanceQ8 - (nInner - 1) * 256, 255));
+                }
+            }
+
+            if (!bIsRing) {
+                int32_t nSide[2];
+                for (int32_t n = 0; n < 2; n++) {
+                    /* the distance to the side in Q14 */
+                    int32_t nSideDistance = nA[n] * nX + nB[n] * nY;
+
+                    if (bAntiAlias) {
+                        /* the coverage of the pixel centred on the side is a half */
+                        nSide[n] = (int32_t)floor(((double)nSideDistance / 16384.0 + 0.5) * 256.0);
+                        nSide[n] = MAX(0, MIN(nSide[n], 255));
+                    } else {
+                        nSide[n] = (nSideDistance >= 0) ? 255 : 0;
+                    }
+                }
+
+                nCoverage = MIN(nCoverage, (nSweep > 180)  ? MAX(nSide[0], nSide[1])
+                                                           : MIN(nSide[0], nSide[1]));
+            }
+
+            if (nCoverage <= 0) {
+                continue;
+            }
+
+            __ARM_2D_PIXEL_BLENDING_OPA_RGB565(
+                &hwColour,
+                &s_hwReference[iY][iX],
+                arm_2d_helper_alpha_mix((uint_fast8_t)nCoverage, chOpacity));
+        }
+    }
+}
+
+/*!
+ * \brief the largest difference of the R, G and B channels of two pixels
+ */
+static uint32_t __rgb565_channel_diff(uint16_t hwA, uint16_t hwB)
+{
+    uint32_t wB = (uint32_t)abs((hwA & 0x1F) - (hwB & 0x1F));
+    uint32_t wG = (uint32_t)abs(((hwA >> 5) & 0x3F) - ((hwB >> 5) & 0x3F));
+    uint32_t wR = (uint32_t)abs((hwA >> 11) - (hwB >> 11));
+
+    return MAX(wR, MAX(wG, wB));
+}
+
+static void __test_circle(  const arm_2d_region_t *ptRegion,
+                            arm_2d_location_t tPivot,
+                            int16_t iRadius,
+                            bool bAntiAlias,
+                            uint16_t hwColour,
+                            uint8_t chOpacity)
+{
+    /* the same random background for both */
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            s_hwScreen[iY][iX] = (uint16_t)rand();
+        }
+    }
+    memcpy(s_hwReference, s_hwScreen, sizeof(s_hwScreen));
+
+    arm_2d_user_draw_circle_api_params_t tParams = {
+        .ptPivot = &tPivot,
+        .iRadius = iRadius,
+        .bAntiAlias = bAntiAlias,
+    };
+
+    arm_2dp_rgb565_user_draw_circle(NULL,
+                                    &c_tScreen,
+                                    ptRegion,
+                                    &tParams,
+                                    (arm_2d_color_rgb565_t){hwColour},
+                                    chOpacity);
+
+    __ref_draw_circle(  (NULL != ptRegion) ? ptRegion : &c_tScreen.tRegion,
+                        tPivot, iRadius, bAntiAlias, hwColour, chOpacity);
+
+    uint32_t wMaxDiff = 0;
+    arm_2d_location_t tWorst = {0};
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            uint32_t wDiff = __rgb565_channel_diff( s_hwScreen[iY][iX],
+                                                    s_hwReference[iY][iX]);
+            if (wDiff > wMaxDiff) {
+                wMaxDiff = wDiff;
+                tWorst = (arm_2d_location_t){(int16_t)iX, (int16_t)iY};
+            }
+        }
+    }
+
+    HOST_TEST_CHECK(wMaxDiff <= TEST_MAX_CHANNEL_DIFF,
+                    "pivot (%d, %d) radius %d AA %d opacity %d: "
+                    "%u LSB at (%d, %d), 0x%04x vs 0x%04x",
+                    tPivot.iX, tPivot.iY, iRadius, bAntiAlias, chOpacity,
+                    wMaxDiff, tWorst.iX, tWorst.iY,
+                    s_hwScreen[tWorst.iY][tWorst.iX],
+                    s_hwReference[tWorst.iY][tWorst.iX]);
+}
+
+static void __test_arc( const arm_2d_region_t *ptRegion,
+                        arm_2d_location_t tPivot,
+                        int16_t iInnerRadius,
+                        int16_t iOuterRadius,
+                        int16_t iStartAngle,
+                        int16_t iEndAngle,
+                        bool bAntiAlias,
+                        uint16_t hwColour,
+                        uint8_t chOpacity)
+{
+    /* the same random background for both */
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            s_hwScreen[iY][iX] = (uint16_t)rand();
+        }
+    }
+    memcpy(s_hwReference, s_hwScreen, sizeof(s_hwScreen));
+
+    arm_2d_user_draw_arc_api_params_t tParams = {
+        .ptPivot = &tPivot,
+        .iInnerRadius = iInnerRadius,
+        .iOuterRadius = iOuterRadius,
+        .iStartAngle = iStartAngle,
+        .iEndAngle = iEndAngle,
+        .bAntiAlias = bAntiAlias,
+    };
+
+    arm_2dp_rgb565_user_draw_arc(   NULL,
+                                    &c_tScreen,
+                                    ptRegion,
+                                    &tParams,
+                                    (arm_2d_color_rgb565_t){hwColour},
+                                    chOpacity);
+
+    __ref_draw_arc( (NULL != ptRegion) ? ptRegion : &c_tScreen.tRegion,
+                    tPivot, iInnerRadius, iOuterRadius, iStartAngle, iEndAngle,
+                    bAntiAlias, hwColour, chOpacity);
+
+    uint32_t wMaxDiff = 0;
+    arm_2d_location_t tWorst = {0};
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            uint32_t wDiff = __rgb565_channel_diff( s_hwScreen[iY][iX],
+                                                    s_hwReference[iY][iX]);
+            if (wDiff > wMaxDiff) {
+                wMaxDiff = wDiff;
+                tWorst = (arm_2d_location_t){(int16_t)iX, (int16_t)iY};
+            }
+        }
+    }
+
+    HOST_TEST_CHECK(wMaxDiff <= TEST_MAX_CHANNEL_DIFF,
+                    "pivot (%d, %d) radius %d ~ %d angle %d ~ %d AA %d opacity %d: "
+                    "%u LSB at (%d, %d), 0x%04x vs 0x%04x",
+                    tPivot.iX, tPivot.iY, iInnerRadius, iOuterRadius, 
+                    iStartAngle, iEndAngle, bAntiAlias, chOpacity,
+                    wMaxDiff, tWorst.iX, tWorst.iY,
+                    s_hwScreen[tWorst.iY][tWorst.iX],
+                    s_hwReference[tWorst.iY][tWorst.iX]);
+}
+
+/*!
+ * \brief compare the gray8 and the cccn888 circles with each other and with
+ *        the coverage of the RGB565 circle
+ */
+static void __test_circle_colour_formats(   const arm_2d_region_t *ptRegion,
+                                            arm_2d_location_t tPivot,
+                                            int16_t iRadius,
+                                            bool bAntiAlias,
+                                            uint8_t chOpacity)
+{
+    arm_2d_user_draw_circle_api_params_t tParams = {
+        .ptPivot = &tPivot,
+        .iRadius = iRadius,
+        .bAntiAlias = bAntiAlias,
+    };
+    uint8_t chGray = (uint8_t)rand();
+
+    /* the same gray background and colour for gray8 and cccn888 */
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            uint8_t chPixel = (uint8_t)rand();
+            s_chGray8Screen[iY][iX] = chPixel;
+            s_wCCCN888Screen[iY][iX] = chPixel * 0x00010101ul;
+        }
+    }
+
+    arm_2dp_gray8_user_draw_circle( NULL, &c_tGray8Screen, ptRegion, &tParams,
+                                    (arm_2d_color_gray8_t){chGray},
+                                    chOpacity);
+    arm_2dp_cccn888_user_draw_circle(   NULL, &c_tCCCN888Screen, ptRegion, &tParams,
+                                        (arm_2d_color_cccn888_t){chGray * 0x00010101ul},
+                                        chOpacity);
+
+    int32_t nDiffs = 0;
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            nDiffs += (s_chGray8Screen[iY][iX] * 0x00010101ul
+                        != (s_wCCCN888Screen[iY][iX] & 0x00FFFFFFul));
+        }
+    }
+    HOST_TEST_CHECK(0 == nDiffs,
+                    "pivot (%d, %d) radius %d: %d cccn888 pixels differ from gray8",
+                    tPivot.iX, tPivot.iY, iRadius, (int)nDiffs);
+
+    /* a white circle on black, the green channel of RGB565 has 6 bits */
+    memset(s_hwScreen, 0, sizeof(s_hwScreen));
+    memset(s_chGray8Screen, 0, sizeof(s_chGray8Screen));
+
+    arm_2dp_rgb565_user_draw_circle(NULL, &c_tScreen, ptRegion, &tParams,
+                                    (arm_2d_color_rgb565_t){0xFFFF},
+                                    chOpacity);
+    arm_2dp_gray8_user_draw_circle( NULL, &c_tGray8Screen, ptRegion, &tParams,
+                                    (arm_2d_color_gray8_t){0xFF},
+                                    chOpacity);
+
+    nDiffs = 0;
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            int32_t nGreen = (s_hwScreen[iY][iX] >> 5) & 0x3F;
+            nDiffs += (abs((s_chGray8Screen[iY][iX] >> 2) - nGreen)
+                        > TEST_MAX_CHANNEL_DIFF);
+        }
+    }
+    HOST_TEST_CHECK(0 == nDiffs,
+                    "pivot (%d, %d) radius %d: %d gray8 pixels differ from RGB565",
+                    tPivot.iX, tPivot.iY, iRadius, (int)nDiffs);
+}
+
+/*!
+ * \brief draw a batch of circles with one op and the same circles one by one
+ */
+static void __test_circles(const arm_2d_region_t *ptRegion, uint_fast16_t hwCount)
+{
+    static const uint8_t c_chOpacity[] = {255, 200, 128, 64, 0};
+    arm_2d_user_circle_t tCircles[ARM_2D_USER_DRAW_CIRCLES_MAX_COUNT];
+    bool bAntiAlias = (0 != (rand() & 0x01));
+
+    assert(hwCount <= dimof(tCircles));
+
+    for (uint_fast16_t n = 0; n < hwCount; n++) {
+        tCircles[n] = (arm_2d_user_circle_t) {
+            .tPivot = {
+                (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+                (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+            },
+            .iRadius = (int16_t)(rand() % 60),
+            .wColour = (uint16_t)rand(),
+            .chOpacity = c_chOpacity[rand() % dimof(c_chOpacity)],
+        };
+    }
+
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            s_hwScreen[iY][iX] = (uint16_t)rand();
+        }
+    }
+    memcpy(s_hwReference, s_hwScreen, sizeof(s_hwScreen));
+
+    arm_fsm_rt_t tResult = arm_2dp_rgb565_user_draw_circles(
+                                NULL,
+                                &c_tScreen,
+                                ptRegion,
+                                &(arm_2d_user_draw_circles_api_params_t) {
+                                    .ptCircles = tCircles,
+                                    .hwCount = (uint16_t)hwCount,
+                                    .bAntiAlias = bAntiAlias,
+                                });
+    HOST_TEST_CHECK(arm_fsm_rt_cpl == tResult, "result %d", tResult);
+
+    /* draw the reference into s_hwScreen, and swap the buffers around it */
+    uint16_t (*phwBatch)[TEST_SCREEN_WIDTH] = malloc(sizeof(s_hwScreen));
+    assert(NULL != phwBatch);
+    memcpy(phwBatch, s_hwScreen, sizeof(s_hwScreen));
+    memcpy(s_hwScreen, s_hwReference, sizeof(s_hwScreen));
+
+    for (uint_fast16_t n = 0; n < hwCount; n++) {
+        arm_2d_location_t tPivot = tCircles[n].tPivot;
+
+        arm_2dp_rgb565_user_draw_circle(NULL,
+                                        &c_tScreen,
+                                        ptRegion,
+                                        &(arm_2d_user_draw_circle_api_params_t) {
+                                            .ptPivot = &tPivot,
+                                            .iRadius = tCircles[n].iRadius,
+                                            .bAntiAlias = bAntiAlias,
+                                        },
+                                        (arm_2d_color_rgb565_t){(uint16_t)tCircles[n].wColour},
+                                        tCircles[n].chOpacity);
+    }
+
+    int32_t nDiffs = 0;
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            nDiffs += (phwBatch[iY][iX] != s_hwScreen[iY][iX]);
+        }
+    }
+    free(phwBatch);
+
+    HOST_TEST_CHECK(0 == nDiffs,
+                    "%d circles AA %d: %d pixels differ from the single circle op",
+                    (int)hwCount, bAntiAlias, (int)nDiffs);
+}
+
+int main(void)
+{
+    static const uint8_t c_chOpacity[] = {255, 254, 200, 128, 64, 8};
+
+    srand(2040);
+
+    /* random circles, clipped or not */
+    for (int32_t n = 0; n < 2000; n++) {
+        arm_2d_location_t tPivot = {
+            (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+            (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+        };
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+
+        __test_circle(  (n & 0x01) ? &tClip : NULL,
+                        tPivot,
+                        (int16_t)(rand() % 140),
+                        (n & 0x02) != 0,
+                        (uint16_t)rand(),
+                        c_chOpacity[rand() % dimof(c_chOpacity)]);
+    }
+
+    /* the squared distance needs more than 16 bits of integer */
+    static const int16_t c_iLargeRadius[] = {256, 511, 512, 600, 1000, 2000};
+    for (int32_t n = 0; n < (int32_t)dimof(c_iLargeRadius); n++) {
+        int16_t iRadius = c_iLargeRadius[n];
+        arm_2d_location_t tPivot = {
+            (int16_t)(TEST_SCREEN_WIDTH / 2),
+            (int16_t)(TEST_SCREEN_HEIGHT / 2 + iRadius - 60),
+        };
+
+        __test_circle(NULL, tPivot, iRadius, true, 0xFFFF, 255);
+        __test_circle(NULL, tPivot, iRadius, true, 0x1234, 128);
+    }
+
+    /* the gray8 and cccn888 ops, with and without anti-alias */
+    for (int32_t n = 0; n < 200; n++) {
+        arm_2d_location_t tPivot = {
+            (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+            (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+        };
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+
+        __test_circle_colour_formats(   (n & 0x01) ? &tClip : NULL,
+                                        tPivot,
+                                        (int16_t)(rand() % 140),
+                                        (n & 0x02) != 0,
+                                        c_chOpacity[rand() % dimof(c_chOpacity)]);
+    }
+
+    /* random arcs, rings and pies, clipped or not */
+    for (int32_t n = 0; n < 2000; n++) {
+        arm_2d_location_t tPivot = {
+            (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+            (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+        };
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+        int16_t iOuterRadius = (int16_t)(rand() % 140);
+        int16_t iInnerRadius = (n & 0x04) ? 0 : (int16_t)(rand() % (iOuterRadius + 1));
+        int16_t iStartAngle = (int16_t)(rand() % 1080 - 360);
+
+        __test_arc( (n & 0x01) ? &tClip : NULL,
+                    tPivot,
+                    iInnerRadius,
+                    iOuterRadius,
+                    iStartAngle,
+                    (int16_t)(iStartAngle + rand() % 450 - 30),
+                    (n & 0x02) != 0,
+                    (uint16_t)rand(),
+                    c_chOpacity[rand() % dimof(c_chOpacity)]);
+    }
+
+    /* a batch of circles against the same circles drawn one by one */
+    for (int32_t n = 0; n < 300; n++) {
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+
+        __test_circles( (n & 0x01) ? &tClip : NULL,
+                        1 + rand() % ARM_2D_USER_DRAW_CIRCLES_MAX_COUNT);
+    }
+
+    HOST_TEST_EXIT("user opcode: draw circle");
+}
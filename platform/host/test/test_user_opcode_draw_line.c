@@ -0,0 +1,717 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * Compares the RGB565 line op with the same op prepared by the original float
+ * code, which computed the slope as (float)dY / (float)dX and clipped X by the
+ * sign of that slope. Both must produce the same state and the same pixels.
+ *
+ * The gray8 and cccn888 ops come from the same template. A cccn888 line on a
+ * gray background must match the gray8 one in every channel, and a white
+ * gray8 line on black must have the coverage of the RGB565 one.
+ *
+ * A list of lines drawn by one op must produce the same pixels as the lines
+ * drawn one by one with the single line op. The single line op clamps the
+ * end points to the region one axis at a time, a line crossing the edge of
+ * the region may touch an extra pixel on the edge, so the lines of this
+ * comparison stay inside of the region.
+ *
+ * The thick line op is compared with a per-pixel kernel, which evaluates the
+ * float distances across and along the line for every pixel of the screen.
+ * The spans round the opacity to 1/32, so each channel may differ by up to
+ * two LSBs. Without anti-alias, a pixel whose coverage is within 1/64 of a
+ * half may fall on either side.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include <stdlib.h>
+#include <math.h>
+
+#include "host_test.h"
+#include "arm_2d_user_opcode_draw_line.c"
+
+/*============================ MACROS ========================================*/
+
+#define TEST_SCREEN_WIDTH       320
+#define TEST_SCREEN_HEIGHT      240
+
+/* the largest difference of a channel, in the LSBs of the channel */
+#define TEST_MAX_CHANNEL_DIFF   2
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+static uint16_t s_hwScreen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+static uint16_t s_hwReference[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+static uint8_t s_chGray8Screen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+static uint32_t s_wCCCN888Screen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+
+/* the pixels that the reference cannot decide, see __ref_draw_thick_line() */
+static bool s_bUndecided[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+
+static arm_2d_tile_t s_tScreen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+};
+
+static const arm_2d_tile_t c_tGray8Screen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+    .pchBuffer = &s_chGray8Screen[0][0],
+};
+
+static const arm_2d_tile_t c_tCCCN888Screen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+    .pwBuffer = &s_wCCCN888Screen[0][0],
+};
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief the original float prepare. A vertical line left the slope
+ *        uninitialised, it is 0 here, the X clip of a single column gives the
+ *        same draw region for either sign.
+ */
+static void __ref_draw_line_prepare(arm_2d_user_draw_line_descriptor_t *ptThis,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_user_draw_line_api_params_t *ptParams)
+{
+    this.tParams = *ptParams;
+
+    arm_2d_location_t tStart = ptParams->tStart;
+    arm_2d_location_t tEnd = ptParams->tEnd;
+
+    if (tStart.iY > tEnd.iY) {
+        tStart = ptParams->tEnd;
+        tEnd = ptParams->tStart;
+    }
+
+    q16_t q16DeltaX = reinterpret_q16_s16(tEnd.iX - tStart.iX);
+    q16_t q16DeltaY = reinterpret_q16_s16(tEnd.iY - tStart.iY);
+    float fK = 0.0f;
+
+    if (0 == q16DeltaY) {
+        this.q16K = 0;
+        this.bUseYAdvance = false;
+    } else if (0 == q16DeltaX) {
+        this.q16dX = 0;
+        this.bUseYAdvance = true;
+    } else {
+        fK = (float)q16DeltaY / (float)q16DeltaX;
+
+        /* the slope, not its Q16 form, is compared with 1.0 in Q16 */
+        if (ABS(fK) >= 65536.0f) {
+            this.bUseYAdvance = true;
+            this.q16dX = (q16_t)((1.0f / fK) * 65536.0f);
+        } else {
+            this.bUseYAdvance = false;
+            this.q16K = (q16_t)(fK * 65536.0f);
+        }
+    }
+
+    arm_2d_region_t tTargetRegion = {0};
+    if (NULL == ptRegion) {
+        tTargetRegion.tSize = ptTarget->tRegion.tSize;
+    } else {
+        tTargetRegion = *ptRegion;
+    }
+
+    tStart.iY = MAX(tStart.iY, tTargetRegion.tLocation.iY);
+    tEnd.iY = MIN(tEnd.iY, (tTargetRegion.tLocation.iY + tTargetRegion.tSize.iHeight - 1));
+
+    if (fK > 0) {
+        tStart.iX = MAX(tStart.iX, tTargetRegion.tLocation.iX);
+        tEnd.iX = MIN(tEnd.iX, (tTargetRegion.tLocation.iX + tTargetRegion.tSize.iWidth - 1));
+    } else {
+        tEnd.iX = MAX(tEnd.iX, tTargetRegion.tLocation.iX);
+        tStart.iX = MIN(tStart.iX, (tTargetRegion.tLocation.iX + tTargetRegion.tSize.iWidth - 1));
+    }
+
+    arm_2d_region_t tStartRegion = {.tSize = {1, 1}, .tLocation = tStart};
+    arm_2d_region_t tEndRegion = {.tSize = {1, 1}, .tLocation = tEnd};
+
+    arm_2d_region_get_minimal_enclosure(&tStartRegion, &tEndRegion, &this.tDrawRegion);
+}
+
+/*!
+ * \brief run the RGB565 line kernel with a prepared descriptor
+ */
+static void __ref_draw_line(arm_2d_user_draw_line_descriptor_t *ptThis,
+                            uint16_t hwColour,
+                            uint8_t chOpacity)
+{
+    this.chOpacity = chOpacity;
+    this.wColour = hwColour;
+
+    __arm_2d_op_acquire((arm_2d_op_core_t *)ptThis);
+
+    OP_CORE.ptOp = &ARM_2D_OP_USER_DRAW_LINE_RGB565;
+    OPCODE.Target.ptTile = &s_tScreen;
+    OPCODE.Target.ptRegion = &this.tDrawRegion;
+
+    __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+static void __test_line(const arm_2d_region_t *ptRegion,
+                        arm_2d_location_t tStart,
+                        arm_2d_location_t tEnd,
+                        uint16_t hwColour,
+                        uint8_t chOpacity)
+{
+    static arm_2d_user_draw_line_descriptor_t s_tLine, s_tReference;
+    arm_2d_user_draw_line_api_params_t tParams = {
+        .tStart = tStart,
+        .tEnd = tEnd,
+    };
+
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            s_hwScreen[iY][iX] = (uint16_t)rand();
+        }
+    }
+    memcpy(s_hwReference, s_hwScreen, sizeof(s_hwScreen));
+
+    s_tScreen.phwBuffer = &s_hwScreen[0][0];
+    arm_fsm_rt_t tResult = arm_2dp_rgb565_user_draw_line(   &s_tLine,
+                                                            &s_tScreen,
+                                                            ptRegion,
+                                                            &tParams,
+                                                            (arm_2d_color_rgb565_t){hwColour},
+                                                            chOpacity);
+    if (0 == tStart.iX - tEnd.iX && 0 == tStart.iY - tEnd.iY) {
+        HOST_TEST_CHECK(ARM_2D_ERR_INVALID_PARAM == (arm_2d_err_t)tResult,
+                        "a point is not a line");
+        return ;
+    }
+    HOST_TEST_CHECK(arm_fsm_rt_cpl == tResult, "result %d", tResult);
+
+    s_tScreen.phwBuffer = &s_hwReference[0][0];
+    __ref_draw_line_prepare(&s_tReference, &s_tScreen, ptRegion, &tParams);
+    __ref_draw_line(&s_tReference, hwColour, chOpacity);
+
+    HOST_TEST_CHECK(    s_tLine.bUseYAdvance == s_tReference.bUseYAdvance
+                    &&  s_tLine.q16K == s_tReference.q16K
+                    &&  0 == memcmp(&s_tLine.tDrawRegion,
+                                    &s_tReference.tDrawRegion,
+                                    sizeof(arm_2d_region_t)),
+                    "(%d, %d) - (%d, %d): the state differs, K 0x%08x vs 0x%08x",
+                    tStart.iX, tStart.iY, tEnd.iX, tEnd.iY,
+                    (unsigned)s_tLine.q16K, (unsigned)s_tReference.q16K);
+
+    HOST_TEST_CHECK(0 == memcmp(s_hwScreen, s_hwReference, sizeof(s_hwScreen)),
+                    "(%d, %d) - (%d, %d): the pixels differ",
+                    tStart.iX, tStart.iY, tEnd.iX, tEnd.iY);
+}
+
+/*!
+ * \brief without anti-alias, a line touches one pixel per step, each of them
+ *        is the nearer one of the two pixels drawn with anti-alias
+ */
+static void __test_line_no_anti_alias(  arm_2d_location_t tStart,
+                                        arm_2d_location_t tEnd)
+{
+    static arm_2d_user_draw_line_descriptor_t s_tLine;
+    arm_2d_user_draw_line_api_params_t tParams = {
+        .tStart = tStart,
+        .tEnd = tEnd,
+        .bNoAntiAlias = true,
+    };
+
+    memset(s_hwScreen, 0, sizeof(s_hwScreen));
+    s_tScreen.phwBuffer = &s_hwScreen[0][0];
+
+    arm_fsm_rt_t tResult = arm_2dp_rgb565_user_draw_line(   &s_tLine,
+                                                            &s_tScreen,
+                                                            NULL,
+                                                            &tParams,
+                                                            (arm_2d_color_rgb565_t){0xFFFF},
+                                                            255);
+    HOST_TEST_CHECK(arm_fsm_rt_cpl == tResult, "result %d", tResult);
+
+    int32_t nSteps = s_tLine.bUseYAdvance   ? s_tLine.tDrawRegion.tSize.iHeight
+                                            : s_tLine.tDrawRegion.tSize.iWidth;
+    int32_t nCount = 0;
+
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            if (0 == s_hwScreen[iY][iX]) {
+                continue;
+            }
+            HOST_TEST_CHECK(0xFFFF == s_hwScreen[iY][iX],
+                            "(%d, %d) - (%d, %d): a blended pixel at (%d, %d)",
+                            tStart.iX, tStart.iY, tEnd.iX, tEnd.iY, iX, iY);
+            nCount++;
+        }
+    }
+
+    HOST_TEST_CHECK(nCount <= nSteps,
+                    "(%d, %d) - (%d, %d): %d pixels for %d steps",
+                    tStart.iX, tStart.iY, tEnd.iX, tEnd.iY, nCount, nSteps);
+}
+
+/*!
+ * \brief compare the gray8 and the cccn888 lines with each other and with the
+ *        coverage of the RGB565 line
+ */
+static void __test_line_colour_formats( const arm_2d_region_t *ptRegion,
+                                        arm_2d_location_t tStart,
+                                        arm_2d_location_t tEnd,
+                                        bool bNoAntiAlias,
+                                        uint8_t chOpacity)
+{
+    static arm_2d_user_draw_line_descriptor_t s_tLine;
+    arm_2d_user_draw_line_api_params_t tParams = {
+        .tStart = tStart,
+        .tEnd = tEnd,
+        .bNoAntiAlias = bNoAntiAlias,
+    };
+    uint8_t chGray = (uint8_t)rand();
+
+    /* the same gray background and colour for gray8 and cccn888 */
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            uint8_t chPixel = (uint8_t)rand();
+            s_chGray8Screen[iY][iX] = chPixel;
+            s_wCCCN888Screen[iY][iX] = chPixel * 0x00010101ul;
+        }
+    }
+
+    arm_2dp_gray8_user_draw_line(   &s_tLine, &c_tGray8Screen, ptRegion, &tParams,
+                                    (arm_2d_color_gray8_t){chGray},
+                                    chOpacity);
+    arm_2dp_cccn888_user_draw_line( &s_tLine, &c_tCCCN888Screen, ptRegion, &tParams,
+                                    (arm_2d_color_cccn888_t){chGray * 0x00010101ul},
+                                    chOpacity);
+
+    int32_t nDiffs = 0;
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            nDiffs += (s_chGray8Screen[iY][iX] * 0x00010101ul
+                        != (s_wCCCN888Screen[iY][iX] & 0x00FFFFFFul));
+        }
+    }
+    HOST_TEST_CHECK(0 == nDiffs,
+                    "(%d, %d) - (%d, %d): %d cccn888 pixels differ from gray8",
+                    tStart.iX, tStart.iY, tEnd.iX, tEnd.iY, (int)nDiffs);
+
+    /* a white line on black, the green channel of RGB565 has 6 bits */
+    memset(s_hwScreen, 0, sizeof(s_hwScreen));
+    memset(s_chGray8Screen, 0, sizeof(s_chGray8Screen));
+    s_tScreen.phwBuffer = &s_hwScreen[0][0];
+
+    arm_2dp_rgb565_user_draw_line(  &s_tLine, &s_tScreen, ptRegion, &tParams,
+                                    (arm_2d_color_rgb565_t){0xFFFF},
+                                    chOpacity);
+    arm_2dp_gray8_user_draw_line(   &s_tLine, &c_tGray8Screen, ptRegion, &tParams,
+                                    (arm_2d_color_gray8_t){0xFF},
+                                    chOpacity);
+
+    nDiffs = 0;
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            int32_t nGreen = (s_hwScreen[iY][iX] >> 5) & 0x3F;
+            nDiffs += (abs((s_chGray8Screen[iY][iX] >> 2) - nGreen) > 1);
+        }
+    }
+    HOST_TEST_CHECK(0 == nDiffs,
+                    "(%d, %d) - (%d, %d): %d gray8 pixels differ from RGB565",
+                    tStart.iX, tStart.iY, tEnd.iX, tEnd.iY, (int)nDiffs);
+}
+
+/*!
+ * \brief the per-pixel thick line with float edge functions
+ */
+static void __ref_draw_thick_line(  const arm_2d_region_t *ptRegion,
+                                    const arm_2d_user_draw_thick_line_api_params_t *ptParams,
+                                    uint16_t hwColour,
+                                    uint8_t chOpacity)
+{
+    double dDeltaX = ptParams->tEnd.iX - ptParams->tStart.iX;
+    double dDeltaY = ptParams->tEnd.iY - ptParams->tStart.iY;
+    double dLength = sqrt(dDeltaX * dDeltaX + dDeltaY * dDeltaY);
+    double dUX = 1.0, dUY = 0.0;
+
+    if (dLength > 0.0) {
+        dUX = dDeltaX / dLength;
+        dUY = dDeltaY / dLength;
+    }
+
+    /* half of the width plus half a pixel, and the same for the caps */
+    double dHalfWidth = (ptParams->chWidth + 1) / 2.0;
+    double dCapLimit = 0.5;
+    if (ARM_2D_USER_LINE_CAP_SQUARE == ptParams->chCap) {
+        dCapLimit += ptParams->chWidth / 2.0;
+    }
+
+    arm_2d_region_t tDrawRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    };
+    if (NULL != ptRegion
+    &&  !arm_2d_region_intersect(ptRegion, &tDrawRegion, &tDrawRegion)) {
+        return ;
+    }
+
+    memset(s_bUndecided, 0, sizeof(s_bUndecided));
+
+    for (int32_t iY = tDrawRegion.tLocation.iY;
+        iY < tDrawRegion.tLocation.iY + tDrawRegion.tSize.iHeight;
+        iY++) {
+        for (int32_t iX = tDrawRegion.tLocation.iX;
+            iX < tDrawRegion.tLocation.iX + tDrawRegion.tSize.iWidth;
+            iX++) {
+
+            double dX = iX - ptParams->tStart.iX;
+            double dY = iY - ptParams->tStart.iY;
+            double dS = dX * dUX + dY * dUY;
+            double dT = dY * dUX - dX * dUY;
+            double dCoverage = dHalfWidth - fabs(dT);
+            double dBeyond = MAX(-dS, dS - dLength);
+
+            if (ARM_2D_USER_LINE_CAP_ROUND == ptParams->chCap) {
+                if (dBeyond > 0.0) {
+                    dCoverage = dHalfWidth - sqrt(dBeyond * dBeyond + dT * dT);
+                }
+            } else {
+                dCoverage = MIN(dCoverage, dCapLimit - dBeyond);
+            }
+
+            if (ptParams->bNoAntiAlias) {
+                if (fabs(dCoverage - 0.5) < (1.0 / 64.0)) {
+                    s_bUndecided[iY][iX] = true;
+                }
+                dCoverage = (dCoverage >= 0.5) ? 1.0 : 0.0;
+            }
+
+            int32_t nCoverage = MIN((int32_t)(dCoverage * 256.0), 255);
+            if (nCoverage <= 0) {
+                continue;
+            }
+
+            __ARM_2D_PIXEL_BLENDING_OPA_RGB565(
+                &hwColour,
+                &s_hwReference[iY][iX],
+                arm_2d_helper_alpha_mix((uint_fast8_t)nCoverage, chOpacity));
+        }
+    }
+}
+
+/*!
+ * \brief the largest difference of the R, G and B channels of two pixels
+ */
+static uint32_t __rgb565_channel_diff(uint16_t hwA, uint16_t hwB)
+{
+    uint32_t wB = (uint32_t)abs((hwA & 0x1F) - (hwB & 0x1F));
+    uint32_t wG = (uint32_t)abs(((hwA >> 5) & 0x3F) - ((hwB >> 5) & 0x3F));
+    uint32_t wR = (uint32_t)abs((hwA >> 11) - (hwB >> 11));
+
+    return MAX(wR, MAX(wG, wB));
+}
+
+static void __test_thick_line(  const arm_2d_region_t *ptRegion,
+                                const arm_2d_user_draw_thick_line_api_params_t *ptParams,
+                                uint16_t hwColour,
+                                uint8_t chOpacity)
+{
+    /* the same random background for both */
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            s_hwScreen[iY][iX] = (uint16_t)rand();
+        }
+    }
+    memcpy(s_hwReference, s_hwScreen, sizeof(s_hwScreen));
+
+    s_tScreen.phwBuffer = &s_hwScreen[0][0];
+    arm_2dp_rgb565_user_draw_thick_line(NULL,
+                                        &s_tScreen,
+                                        ptRegion,
+                                        ptParams,
+                                        (arm_2d_color_rgb565_t){hwColour},
+                                        chOpacity);
+
+    __ref_draw_thick_line(ptRegion, ptParams, hwColour, chOpacity);
+
+    uint32_t wMaxDiff = 0;
+    arm_2d_location_t tWorst = {0};
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            if (s_bUndecided[iY][iX]) {
+                continue;
+            }
+
+            uint32_t wDiff = __rgb565_channel_diff( s_hwScreen[iY][iX],
+                                                    s_hwReference[iY][iX]);
+            if (wDiff > wMaxDiff) {
+                wMaxDiff = wDiff;
+                tWorst = (arm_2d_location_t){(int16_t)iX, (int16_t)iY};
+            }
+        }
+    }
+
+    HOST_TEST_CHECK(wMaxDiff <= TEST_MAX_CHANNEL_DIFF,
+                    "(%d, %d) - (%d, %d) width %d cap %d AA %d opacity %d: "
+                    "%u LSB at (%d, %d), 0x%04x vs 0x%04x",
+                    ptParams->tStart.iX, ptParams->tStart.iY,
+                    ptParams->tEnd.iX, ptParams->tEnd.iY,
+                    ptParams->chWidth, ptParams->chCap, !ptParams->bNoAntiAlias,
+                    chOpacity, wMaxDiff, tWorst.iX, tWorst.iY,
+                    s_hwScreen[tWorst.iY][tWorst.iX],
+                    s_hwReference[tWorst.iY][tWorst.iX]);
+}
+
+/*!
+ * \brief draw a list of lines with one op and the same lines one by one
+ */
+static void __test_lines(const arm_2d_region_t *ptRegion, uint_fast16_t hwCount)
+{
+    static const arm_2d_region_t c_tFullScreen = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    };
+    const arm_2d_region_t *ptInside = (NULL == ptRegion) ? &c_tFullScreen 
+                                                         : ptRegion;
+    static arm_2d_user_draw_lines_descriptor_t s_tLines;
+    static arm_2d_user_draw_line_descriptor_t s_tLine;
+    arm_2d_user_draw_line_api_params_t tLines[ARM_2D_USER_DRAW_LINES_MAX_SEGMENTS];
+    uint16_t hwColour = (uint16_t)rand();
+    uint8_t chOpacity = (uint8_t)(rand() % 256);
+
+    assert(hwCount <= dimof(tLines));
+
+    for (uint_fast16_t n = 0; n < hwCount; n++) {
+        tLines[n] = (arm_2d_user_draw_line_api_params_t) {
+            .tStart = {
+                (int16_t)(ptInside->tLocation.iX + rand() % ptInside->tSize.iWidth),
+                (int16_t)(ptInside->tLocation.iY + rand() % ptInside->tSize.iHeight),
+            },
+            .tEnd = {
+                (int16_t)(ptInside->tLocation.iX + rand() % ptInside->tSize.iWidth),
+                (int16_t)(ptInside->tLocation.iY + rand() % ptInside->tSize.iHeight),
+            },
+            .bNoAntiAlias = (0 == (rand() & 0x03)),
+        };
+
+        switch (rand() & 0x07) {
+            case 0:
+                tLines[n].tEnd.iX = tLines[n].tStart.iX;
+                break;
+            case 1:
+                tLines[n].tEnd.iY = tLines[n].tStart.iY;
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            s_hwScreen[iY][iX] = (uint16_t)rand();
+        }
+    }
+    memcpy(s_hwReference, s_hwScreen, sizeof(s_hwScreen));
+
+    s_tScreen.phwBuffer = &s_hwScreen[0][0];
+    arm_fsm_rt_t tResult = arm_2dp_rgb565_user_draw_lines(
+                                &s_tLines,
+                                &s_tScreen,
+                                ptRegion,
+                                &(arm_2d_user_draw_lines_api_params_t) {
+                                    .ptLines = tLines,
+                                    .hwCount = (uint16_t)hwCount,
+                                },
+                                (arm_2d_color_rgb565_t){hwColour},
+                                chOpacity);
+    HOST_TEST_CHECK(arm_fsm_rt_cpl == tResult, "result %d", tResult);
+
+    s_tScreen.phwBuffer = &s_hwReference[0][0];
+    for (uint_fast16_t n = 0; n < hwCount; n++) {
+        /* a point is rejected by the single line op and skipped by the list */
+        arm_2dp_rgb565_user_draw_line(  &s_tLine,
+                                        &s_tScreen,
+                                        ptRegion,
+                                        &tLines[n],
+                                        (arm_2d_color_rgb565_t){hwColour},
+                                        chOpacity);
+    }
+
+    int32_t nDiffs = 0;
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            nDiffs += (s_hwScreen[iY][iX] != s_hwReference[iY][iX]);
+        }
+    }
+    HOST_TEST_CHECK(0 == nDiffs,
+                    "%d lines: %d pixels differ from the single line op",
+                    (int)hwCount, (int)nDiffs);
+}
+
+int main(void)
+{
+    static const uint8_t c_chOpacity[] = {255, 254, 200, 128, 64, 8};
+
+    srand(2040);
+
+    /* random lines, clipped or not, some of them vertical or horizontal */
+    for (int32_t n = 0; n < 5000; n++) {
+        arm_2d_location_t tStart = {
+            (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+            (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+        };
+        arm_2d_location_t tEnd = {
+            (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+            (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+        };
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+
+        switch (n & 0x0C) {
+            case 0x04:
+                tEnd.iX = tStart.iX;
+                break;
+            case 0x08:
+                tEnd.iY = tStart.iY;
+                break;
+            default:
+                break;
+        }
+
+        __test_line((n & 0x01) ? &tClip : NULL,
+                    tStart,
+                    tEnd,
+                    (uint16_t)rand(),
+                    c_chOpacity[rand() % dimof(c_chOpacity)]);
+    }
+
+    /* lines inside of the screen, without anti-alias */
+    for (int32_t n = 0; n < 500; n++) {
+        arm_2d_location_t tStart = {
+            (int16_t)(rand() % TEST_SCREEN_WIDTH),
+            (int16_t)(rand() % TEST_SCREEN_HEIGHT),
+        };
+        arm_2d_location_t tEnd = {
+            (int16_t)(rand() % TEST_SCREEN_WIDTH),
+            (int16_t)(rand() % TEST_SCREEN_HEIGHT),
+        };
+
+        if (tStart.iX == tEnd.iX && tStart.iY == tEnd.iY) {
+            continue;
+        }
+
+        __test_line_no_anti_alias(tStart, tEnd);
+    }
+
+    /* the gray8 and cccn888 ops, with and without anti-alias */
+    for (int32_t n = 0; n < 200; n++) {
+        arm_2d_location_t tStart = {
+            (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+            (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+        };
+        arm_2d_location_t tEnd = {
+            (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+            (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+        };
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+
+        if (tStart.iX == tEnd.iX && tStart.iY == tEnd.iY) {
+            continue;
+        }
+
+        __test_line_colour_formats( (n & 0x01) ? &tClip : NULL,
+                                    tStart,
+                                    tEnd,
+                                    (n & 0x02) != 0,
+                                    c_chOpacity[rand() % dimof(c_chOpacity)]);
+    }
+
+    /* random thick lines with all caps, clipped or not, some of them dots */
+    for (int32_t n = 0; n < 1000; n++) {
+        arm_2d_user_draw_thick_line_api_params_t tParams = {
+            .tStart = {
+                (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+                (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+            },
+            .tEnd = {
+                (int16_t)(rand() % (TEST_SCREEN_WIDTH + 80) - 40),
+                (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 80) - 40),
+            },
+            .chWidth = (uint8_t)(1 + rand() % 24),
+            .chCap = (uint8_t)(rand() % 3),
+            .bNoAntiAlias = (0 == (rand() & 0x03)),
+        };
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+
+        if (0 == (n & 0x3E)) {
+            tParams.tEnd = tParams.tStart;
+        }
+
+        __test_thick_line(  (n & 0x01) ? &tClip : NULL,
+                            &tParams,
+                            (uint16_t)rand(),
+                            c_chOpacity[rand() % dimof(c_chOpacity)]);
+    }
+
+    /* a list of lines against the same lines drawn one by one */
+    for (int32_t n = 0; n < 500; n++) {
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % (TEST_SCREEN_WIDTH / 2)),
+                (int16_t)(rand() % (TEST_SCREEN_HEIGHT / 2)),
+            },
+            .tSize = {
+                (int16_t)(rand() % (TEST_SCREEN_WIDTH / 2) + 1),
+                (int16_t)(rand() % (TEST_SCREEN_HEIGHT / 2) + 1),
+            },
+        };
+
+        __test_lines(   (n & 0x01) ? &tClip : NULL,
+                        1 + rand() % ARM_2D_USER_DRAW_LINES_MAX_SEGMENTS);
+    }
+
+    HOST_TEST_EXIT("user opcode: draw line");
+}
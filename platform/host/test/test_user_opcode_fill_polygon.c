@@ -0,0 +1,405 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * Compares the RGB565 polygon op with a per-pixel kernel, which evaluates the
+ * float distance of every pixel of the screen to every edge. The coverage of
+ * a pixel is the smallest distance plus half a pixel. The spans round the
+ * opacity to 1/32, so each channel may differ by up to two LSBs. Without
+ * anti-alias, a pixel whose distance is within 1/64 of the edge may fall on
+ * either side. Like the op, the reference only draws the bounding box of the
+ * vertices with one more pixel around.
+ *
+ * The edges of the op are Q14 unit normals, a pixel far from the first vertex
+ * gets a larger error, so the polygons stay within 200 pixels of the screen.
+ *
+ * The vertices are sorted by their angle around a centre, rounding them may
+ * turn the polygon concave, and then the op must reject it.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include <stdlib.h>
+#include <math.h>
+
+#include "host_test.h"
+#include "arm_2d_user_opcode_fill_polygon.c"
+
+/*============================ MACROS ========================================*/
+
+#define TEST_SCREEN_WIDTH       320
+#define TEST_SCREEN_HEIGHT      240
+
+/* the largest difference of a channel, in the LSBs of the channel */
+#define TEST_MAX_CHANNEL_DIFF   2
+
+#ifndef M_PI
+#   define M_PI                 3.14159265358979323846
+#endif
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+static uint16_t s_hwScreen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+static uint16_t s_hwReference[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+
+/* the pixels that the reference cannot decide, see __ref_fill_polygon() */
+static bool s_bUndecided[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+
+static arm_2d_tile_t s_tScreen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+};
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief twice of the signed area, 0 for a polygon without area
+ */
+static int64_t __ref_polygon_area2( const arm_2d_location_t *ptVertices,
+                                    uint_fast8_t chCount)
+{
+    int64_t lArea2 = 0;
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        arm_2d_location_t tFrom = ptVertices[n];
+        arm_2d_location_t tTo = ptVertices[(n + 1) % chCount];
+
+        lArea2 += (int64_t)tFrom.iX * tTo.iY - (int64_t)tTo.iX * tFrom.iY;
+    }
+
+    return lArea2;
+}
+
+/*!
+ * \brief a polygon of vertices sorted by angle is simple, it is convex when
+ *        every corner turns the same way or goes straight on
+ */
+static bool __ref_polygon_is_convex(const arm_2d_location_t *ptVertices,
+                                    uint_fast8_t chCount)
+{
+    int_fast8_t nTurn = 0;
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        arm_2d_location_t tA = ptVertices[n];
+        arm_2d_location_t tB = ptVertices[(n + 1) % chCount];
+        arm_2d_location_t tC = ptVertices[(n + 2) % chCount];
+
+        int64_t lCross = (int64_t)(tB.iX - tA.iX) * (tC.iY - tB.iY)
+                       - (int64_t)(tB.iY - tA.iY) * (tC.iX - tB.iX);
+        int64_t lDot = (int64_t)(tB.iX - tA.iX) * (tC.iX - tB.iX)
+                     + (int64_t)(tB.iY - tA.iY) * (tC.iY - tB.iY);
+
+        if (0 == lCross) {
+            if (lDot < 0) {
+                return false;
+            }
+        } else if (0 == nTurn) {
+            nTurn = (lCross > 0) ? 1 : -1;
+        } else if ((lCross > 0) != (nTurn > 0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief the per-pixel polygon with float edge functions
+ */
+static void __ref_fill_polygon( const arm_2d_region_t *ptRegion,
+                                const arm_2d_user_fill_polygon_api_params_t *ptParams,
+                                uint16_t hwColour,
+                                uint8_t chOpacity)
+{
+    const arm_2d_location_t *ptVertices = ptParams->ptVertices;
+    uint_fast8_t chCount = ptParams->chCount;
+    double dWinding = (__ref_polygon_area2(ptVertices, chCount) > 0) ? 1.0 : -1.0;
+
+    /* the bounding box with one more pixel around, it cuts the half planes
+     * beyond a sharp corner
+     */
+    int16_t iMinX = INT16_MAX, iMinY = INT16_MAX;
+    int16_t iMaxX = INT16_MIN, iMaxY = INT16_MIN;
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        iMinX = MIN(iMinX, ptVertices[n].iX);
+        iMinY = MIN(iMinY, ptVertices[n].iY);
+        iMaxX = MAX(iMaxX, ptVertices[n].iX);
+        iMaxY = MAX(iMaxY, ptVertices[n].iY);
+    }
+
+    arm_2d_region_t tDrawRegion = {
+        .tLocation = {iMinX - 1, iMinY - 1},
+        .tSize = {iMaxX - iMinX + 3, iMaxY - iMinY + 3},
+    };
+    arm_2d_region_t tScreenRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    };
+    if (NULL != ptRegion
+    &&  !arm_2d_region_intersect(ptRegion, &tScreenRegion, &tScreenRegion)) {
+        return ;
+    }
+    if (!arm_2d_region_intersect(&tScreenRegion, &tDrawRegion, &tDrawRegion)) {
+        return ;
+    }
+
+    memset(s_bUndecided, 0, sizeof(s_bUndecided));
+
+    for (int32_t iY = tDrawRegion.tLocation.iY;
+        iY < tDrawRegion.tLocation.iY + tDrawRegion.tSize.iHeight;
+        iY++) {
+        for (int32_t iX = tDrawRegion.tLocation.iX;
+            iX < tDrawRegion.tLocation.iX + tDrawRegion.tSize.iWidth;
+            iX++) {
+
+            /* the distance to the nearest edge, positive inside */
+            double dDistance = INFINITY;
+
+            for (uint_fast8_t n = 0; n < chCount; n++) {
+                arm_2d_location_t tFrom = ptVertices[n];
+                arm_2d_location_t tTo = ptVertices[(n + 1) % chCount];
+                double dDeltaX = tTo.iX - tFrom.iX;
+                double dDeltaY = tTo.iY - tFrom.iY;
+                double dLength = sqrt(dDeltaX * dDeltaX + dDeltaY * dDeltaY);
+
+                if (0.0 == dLength) {
+                    continue;
+                }
+
+                double dEdge = dWinding
+                             * (dDeltaX * (iY - tFrom.iY) - dDeltaY * (iX - tFrom.iX))
+                             / dLength;
+                dDistance = MIN(dDistance, dEdge);
+            }
+
+            double dCoverage = MIN(dDistance + 0.5, 1.0);
+
+            if (!ptParams->bAntiAlias) {
+                if (fabs(dDistance) < (1.0 / 64.0)) {
+                    s_bUndecided[iY][iX] = true;
+                }
+                dCoverage = (dDistance >= 0.0) ? 1.0 : 0.0;
+            }
+
+            int32_t nCoverage = MIN((int32_t)(dCoverage * 256.0), 255);
+            if (nCoverage <= 0) {
+                continue;
+            }
+
+            __ARM_2D_PIXEL_BLENDING_OPA_RGB565(
+                &hwColour,
+                &s_hwReference[iY][iX],
+                arm_2d_helper_alpha_mix((uint_fast8_t)nCoverage, chOpacity));
+        }
+    }
+}
+
+/*!
+ * \brief the largest difference of the R, G and B channels of two pixels
+ */
+static uint32_t __rgb565_channel_diff(uint16_t hwA, uint16_t hwB)
+{
+    uint32_t wB = (uint32_t)abs((hwA & 0x1F) - (hwB & 0x1F));
+    uint32_t wG = (uint32_t)abs(((hwA >> 5) & 0x3F) - ((hwB >> 5) & 0x3F));
+    uint32_t wR = (uint32_t)abs((hwA >> 11) - (hwB >> 11));
+
+    return MAX(wR, MAX(wG, wB));
+}
+
+static void __test_polygon( const arm_2d_region_t *ptRegion,
+                            const arm_2d_user_fill_polygon_api_params_t *ptParams,
+                            uint16_t hwColour,
+                            uint8_t chOpacity)
+{
+    static arm_2d_user_fill_polygon_descriptor_t s_tPolygon;
+    const arm_2d_location_t *ptVertices = ptParams->ptVertices;
+    bool bConvex = __ref_polygon_is_convex(ptVertices, ptParams->chCount);
+
+    /* the same random background for both */
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            s_hwScreen[iY][iX] = (uint16_t)rand();
+        }
+    }
+    memcpy(s_hwReference, s_hwScreen, sizeof(s_hwScreen));
+
+    s_tScreen.phwBuffer = &s_hwScreen[0][0];
+    arm_fsm_rt_t tResult = arm_2dp_rgb565_user_fill_polygon(&s_tPolygon,
+                                                            &s_tScreen,
+                                                            ptRegion,
+                                                            ptParams,
+                                                            (arm_2d_color_rgb565_t){hwColour},
+                                                            chOpacity);
+    if (!bConvex) {
+        HOST_TEST_CHECK(ARM_2D_ERR_INVALID_PARAM == (arm_2d_err_t)tResult,
+                        "(%d, %d) and %d more vertices: a concave polygon, "
+                        "result %d",
+                        ptVertices[0].iX, ptVertices[0].iY,
+                        ptParams->chCount - 1, tResult);
+        return ;
+    }
+    HOST_TEST_CHECK(arm_fsm_rt_cpl == tResult, "result %d", tResult);
+
+    __ref_fill_polygon(ptRegion, ptParams, hwColour, chOpacity);
+
+    uint32_t wMaxDiff = 0;
+    arm_2d_location_t tWorst = {0};
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            if (s_bUndecided[iY][iX]) {
+                continue;
+            }
+
+            uint32_t wDiff = __rgb565_channel_diff( s_hwScreen[iY][iX],
+                                                    s_hwReference[iY][iX]);
+            if (wDiff > wMaxDiff) {
+                wMaxDiff = wDiff;
+                tWorst = (arm_2d_location_t){(int16_t)iX, (int16_t)iY};
+            }
+        }
+    }
+
+    HOST_TEST_CHECK(wMaxDiff <= TEST_MAX_CHANNEL_DIFF,
+                    "(%d, %d) and %d more vertices, AA %d opacity %d: "
+                    "%u LSB at (%d, %d), 0x%04x vs 0x%04x",
+                    ptVertices[0].iX, ptVertices[0].iY,
+                    ptParams->chCount - 1, ptParams->bAntiAlias,
+                    chOpacity, wMaxDiff, tWorst.iX, tWorst.iY,
+                    s_hwScreen[tWorst.iY][tWorst.iX],
+                    s_hwReference[tWorst.iY][tWorst.iX]);
+}
+
+/*!
+ * \brief vertices on a circle, sorted by their angles in either direction
+ * \return false when the vertices repeat or have no area
+ */
+static bool __make_polygon( arm_2d_location_t *ptVertices,
+                            uint_fast8_t chCount,
+                            int32_t nCentreX,
+                            int32_t nCentreY,
+                            int32_t nRadius)
+{
+    double dAngles[ARM_2D_USER_FILL_POLYGON_MAX_VERTICES];
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        double dAngle = (double)rand() / RAND_MAX * 2.0 * M_PI;
+        uint_fast8_t m = n;
+
+        /* insertion sort */
+        for (; m > 0 && dAngles[m - 1] > dAngle; m--) {
+            dAngles[m] = dAngles[m - 1];
+        }
+        dAngles[m] = dAngle;
+    }
+
+    bool bReverse = (0 != (rand() & 0x01));
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        double dAngle = dAngles[bReverse ? (chCount - 1 - n) : n];
+
+        ptVertices[n] = (arm_2d_location_t) {
+            (int16_t)lround(nCentreX + nRadius * cos(dAngle)),
+            (int16_t)lround(nCentreY + nRadius * sin(dAngle)),
+        };
+    }
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        if (    ptVertices[n].iX == ptVertices[(n + 1) % chCount].iX
+            &&  ptVertices[n].iY == ptVertices[(n + 1) % chCount].iY) {
+            return false;
+        }
+    }
+
+    return 0 != __ref_polygon_area2(ptVertices, chCount);
+}
+
+int main(void)
+{
+    static const uint8_t c_chOpacity[] = {255, 254, 200, 128, 64, 8};
+
+    srand(2040);
+
+    /* random polygons, clipped or not, small, large or far beyond the screen */
+    for (int32_t n = 0; n < 2000; n++) {
+        static const int32_t c_nRadius[] = {8, 60, 200};
+        arm_2d_location_t tVertices[ARM_2D_USER_FILL_POLYGON_MAX_VERTICES];
+        arm_2d_user_fill_polygon_api_params_t tParams = {
+            .ptVertices = tVertices,
+            .chCount = (uint8_t)(3 + rand() % (ARM_2D_USER_FILL_POLYGON_MAX_VERTICES - 2)),
+            .bAntiAlias = (0 != (rand() & 0x03)),
+        };
+        arm_2d_region_t tClip = {
+            .tLocation = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH - 20),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT - 20),
+            },
+            .tSize = {
+                (int16_t)(rand() % TEST_SCREEN_WIDTH + 1),
+                (int16_t)(rand() % TEST_SCREEN_HEIGHT + 1),
+            },
+        };
+
+        if (!__make_polygon(tVertices,
+                            tParams.chCount,
+                            rand() % (TEST_SCREEN_WIDTH + 80) - 40,
+                            rand() % (TEST_SCREEN_HEIGHT + 80) - 40,
+                            1 + rand() % c_nRadius[rand() % dimof(c_nRadius)])) {
+            continue;
+        }
+
+        __test_polygon( (n & 0x01) ? &tClip : NULL,
+                        &tParams,
+                        (uint16_t)rand(),
+                        c_chOpacity[rand() % dimof(c_chOpacity)]);
+    }
+
+    /* a dart and a pentagram are not convex */
+    do {
+        static const arm_2d_location_t c_tDart[] = {
+            {20, 20}, {120, 60}, {20, 100}, {50, 60},
+        };
+        static const arm_2d_location_t c_tPentagram[] = {
+            {160, 20}, {200, 140}, {100, 66}, {220, 66}, {120, 140},
+        };
+
+        __test_polygon( NULL,
+                        &(arm_2d_user_fill_polygon_api_params_t) {
+                            .ptVertices = c_tDart,
+                            .chCount = dimof(c_tDart),
+                            .bAntiAlias = true,
+                        },
+                        0xFFFF, 255);
+
+        arm_fsm_rt_t tResult = arm_2dp_rgb565_user_fill_polygon(
+                                    &(arm_2d_user_fill_polygon_descriptor_t){0},
+                                    &s_tScreen,
+                                    NULL,
+                                    &(arm_2d_user_fill_polygon_api_params_t) {
+                                        .ptVertices = c_tPentagram,
+                                        .chCount = dimof(c_tPentagram),
+                                        .bAntiAlias = true,
+                                    },
+                                    (arm_2d_color_rgb565_t){0xFFFF},
+                                    255);
+        HOST_TEST_CHECK(ARM_2D_ERR_INVALID_PARAM == (arm_2d_err_t)tResult,
+                        "the pentagram is not convex, result %d", tResult);
+    } while(0);
+
+    HOST_TEST_EXIT("user opcode: fill polygon");
+}
@@ -0,0 +1,168 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*
+ * Checks the LUT index of every pixel of the gray8 radial gradient op. The
+ * first frame prepares the descriptor, then the colour of each LUT entry is
+ * replaced with its index and the op draws again without preparing, i.e. as
+ * the rest PFBs of a frame.
+ *
+ * A pixel at distance^2 d2 must use the entry d2 * LUT_SIZE / radius^2,
+ * rounded down. wScale is rounded, so the index may be one less or one more
+ * only when the exact value is within d2 >> SCALE_BITS of an integer.
+ * A pixel outside of the disc is not touched.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include <stdlib.h>
+
+#include "host_test.h"
+#include "arm_2d_user_opcode_radial_gradient.c"
+
+/*============================ MACROS ========================================*/
+
+#define TEST_SCREEN_WIDTH       320
+#define TEST_SCREEN_HEIGHT      240
+
+/* a colour that no LUT entry has */
+#define TEST_BACKGROUND         0xFF
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+static uint8_t s_chScreen[TEST_SCREEN_HEIGHT][TEST_SCREEN_WIDTH];
+
+static const arm_2d_tile_t c_tScreen = {
+    .tRegion = {
+        .tSize = {TEST_SCREEN_WIDTH, TEST_SCREEN_HEIGHT},
+    },
+    .pchBuffer = &s_chScreen[0][0],
+};
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+static void __test_radial_gradient(arm_2d_location_t tPivot, int16_t iRadius)
+{
+    static arm_2d_user_radial_gradient_descriptor_t s_tGradient;
+    arm_2d_user_radial_gradient_api_params_t tParams = {
+        .ptPivot = &tPivot,
+        .iRadius = iRadius,
+        .wCentreColour = 0x00,
+        .wEdgeColour = 0xFE,
+        .chCentreOpacity = 255,
+        .chEdgeOpacity = 0,
+    };
+
+    /* prepare the descriptor */
+    g_bHostStubIsNewFrame = true;
+    arm_fsm_rt_t tResult = arm_2dp_gray8_user_fill_radial_gradient(&s_tGradient,
+                                                                    &c_tScreen,
+                                                                    NULL,
+                                                                    &tParams);
+    HOST_TEST_CHECK(arm_fsm_rt_cpl == tResult, "result %d", tResult);
+
+    /* each entry draws its own index */
+    for (uint_fast16_t n = 0; n < ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE; n++) {
+        s_tGradient.wColours[n] = n;
+        s_tGradient.chOpacities[n] = 255;
+    }
+
+    memset(s_chScreen, TEST_BACKGROUND, sizeof(s_chScreen));
+
+    g_bHostStubIsNewFrame = false;
+    tResult = arm_2dp_gray8_user_fill_radial_gradient(  &s_tGradient,
+                                                        &c_tScreen,
+                                                        NULL,
+                                                        &tParams);
+    HOST_TEST_CHECK(arm_fsm_rt_cpl == tResult, "result %d", tResult);
+
+    uint64_t dllRadius2 = (uint64_t)iRadius * (uint64_t)iRadius;
+    int32_t nWrongs = 0;
+    int32_t nStrays = 0;
+
+    for (int32_t iY = 0; iY < TEST_SCREEN_HEIGHT; iY++) {
+        for (int32_t iX = 0; iX < TEST_SCREEN_WIDTH; iX++) {
+            int64_t lDX = iX - tPivot.iX;
+            int64_t lDY = iY - tPivot.iY;
+            uint64_t dllDistance2 = (uint64_t)(lDX * lDX + lDY * lDY);
+
+            if (dllDistance2 >= dllRadius2) {
+                nStrays += (TEST_BACKGROUND != s_chScreen[iY][iX]);
+                continue;
+            }
+
+            /* the index scaled by radius^2 */
+            uint64_t dllScaled = dllDistance2 * ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE;
+            uint64_t dllIndex = dllScaled / dllRadius2;
+            uint64_t dllRemain = dllScaled % dllRadius2;
+
+            /* wScale is off by up to 1, the index by d2 >> SCALE_BITS */
+            uint64_t dllMargin = ((dllDistance2 * dllRadius2)
+                                    >> __ARM_2D_USER_RADIAL_GRADIENT_SCALE_BITS) + 1;
+
+            if (s_chScreen[iY][iX] == dllIndex) {
+                continue;
+            }
+            if (    s_chScreen[iY][iX] == dllIndex - 1
+                &&  dllRemain < dllMargin) {
+                continue;
+            }
+            if (    s_chScreen[iY][iX] == dllIndex + 1
+                &&  dllRadius2 - dllRemain < dllMargin) {
+                continue;
+            }
+            nWrongs++;
+        }
+    }
+
+    HOST_TEST_CHECK(0 == nWrongs,
+                    "pivot (%d, %d) radius %d: %d pixels use a wrong entry",
+                    tPivot.iX, tPivot.iY, iRadius, (int)nWrongs);
+    HOST_TEST_CHECK(0 == nStrays,
+                    "pivot (%d, %d) radius %d: %d pixels outside of the disc",
+                    tPivot.iX, tPivot.iY, iRadius, (int)nStrays);
+}
+
+int main(void)
+{
+    srand(2040);
+
+    /* every small radius in the middle of the screen */
+    for (int16_t iRadius = 1; iRadius <= 120; iRadius++) {
+        __test_radial_gradient( (arm_2d_location_t){
+                                    TEST_SCREEN_WIDTH / 2,
+                                    TEST_SCREEN_HEIGHT / 2,
+                                },
+                                iRadius);
+    }
+
+    /* random pivots and radii, some of them much larger than the screen */
+    for (int32_t n = 0; n < 200; n++) {
+        static const int32_t c_nRadius[] = {60, 400, 2000};
+
+        __test_radial_gradient( (arm_2d_location_t){
+                                    (int16_t)(rand() % (TEST_SCREEN_WIDTH + 200) - 100),
+                                    (int16_t)(rand() % (TEST_SCREEN_HEIGHT + 200) - 100),
+                                },
+                                (int16_t)(1 + rand() % c_nRadius[rand() % dimof(c_nRadius)]));
+    }
+
+    HOST_TEST_EXIT("user opcode: radial gradient");
+}
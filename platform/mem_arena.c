@@ -0,0 +1,100 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*============================ INCLUDES ======================================*/
+#include "./mem_arena.h"
+
+#include <string.h>
+#include <assert.h>
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+ARM_NONNULL(1)
+bool mem_arena_init(mem_arena_t *ptThis, 
+                    uint32_t wSize, 
+                    arm_2d_mem_type_t tType)
+{
+    memset(ptThis, 0, sizeof(mem_arena_t));
+
+    ptThis->pchBuffer = __arm_2d_allocate_scratch_memory(wSize, 8, tType);
+    if (NULL == ptThis->pchBuffer) {
+        return false;
+    }
+
+    ptThis->wSize = wSize;
+    ptThis->tType = tType;
+
+    return true;
+}
+
+ARM_NONNULL(1)
+void *mem_arena_alloc(mem_arena_t *ptThis, uint32_t wSize, uint32_t wAlign)
+{
+    /* ensure wAlign is 2^n */
+    wAlign = MAX(wAlign, 1);
+    assert(0 == (wAlign & (wAlign - 1)));
+
+    uintptr_t pnBase = (uintptr_t)ptThis->pchBuffer;
+    uintptr_t pnAddress = (pnBase + ptThis->wUsed + wAlign - 1) 
+                        & ~(uintptr_t)(wAlign - 1);
+
+    if (NULL == ptThis->pchBuffer
+    ||  pnAddress + wSize > pnBase + ptThis->wSize) {
+        return NULL;
+    }
+
+    ptThis->wUsed = (uint32_t)(pnAddress + wSize - pnBase);
+    ptThis->wPeak = MAX(ptThis->wPeak, ptThis->wUsed);
+
+    return (void *)pnAddress;
+}
+
+ARM_NONNULL(1)
+void *mem_arena_alloc_persistent(   mem_arena_t *ptThis, 
+                                    uint32_t wSize, 
+                                    uint32_t wAlign)
+{
+    assert(ptThis->wUsed == ptThis->wPersistent);
+
+    void *pMem = mem_arena_alloc(ptThis, wSize, wAlign);
+    if (NULL != pMem) {
+        ptThis->wPersistent = ptThis->wUsed;
+    }
+
+    return pMem;
+}
+
+ARM_NONNULL(1)
+void mem_arena_reset(mem_arena_t *ptThis)
+{
+    ptThis->wUsed = ptThis->wPersistent;
+}
+
+ARM_NONNULL(1)
+void mem_arena_depose(mem_arena_t *ptThis)
+{
+    if (NULL != ptThis->pchBuffer) {
+        __arm_2d_free_scratch_memory(ptThis->tType, ptThis->pchBuffer);
+    }
+    memset(ptThis, 0, sizeof(mem_arena_t));
+}
@@ -0,0 +1,114 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __MEM_ARENA_H__
+#define __MEM_ARENA_H__
+
+/*============================ INCLUDES ======================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arm_2d.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief a scene-lifetime arena
+ * \note  The buffer is allocated once when a scene is loaded. The persistent
+ *        allocations live until the arena is deposed, the frame allocations
+ *        are released in bulk by mem_arena_reset() on each new frame.
+ */
+typedef struct mem_arena_t {
+    uint8_t *pchBuffer;
+    uint32_t wSize;
+    uint32_t wPersistent;               //!< the top of the persistent allocations
+    uint32_t wUsed;                     //!< the top of all allocations
+    uint32_t wPeak;                     //!< the peak of wUsed
+    arm_2d_mem_type_t tType;
+} mem_arena_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*!
+ * \brief allocate the buffer of an arena from the scratch memory
+ * \param[in] ptThis the target arena
+ * \param[in] wSize the working-set size of the scene
+ * \param[in] tType the memory type
+ * \retval true the arena is ready
+ * \retval false insufficient memory
+ */
+extern
+ARM_NONNULL(1)
+bool mem_arena_init(mem_arena_t *ptThis, 
+                    uint32_t wSize, 
+                    arm_2d_mem_type_t tType);
+
+/*!
+ * \brief allocate memory which lives until the arena is reset
+ * \param[in] ptThis the target arena
+ * \param[in] wSize the size in bytes
+ * \param[in] wAlign the alignment, it must be 2^n
+ * \return void* the memory, NULL means the working-set is too small
+ */
+extern
+ARM_NONNULL(1)
+void *mem_arena_alloc(mem_arena_t *ptThis, uint32_t wSize, uint32_t wAlign);
+
+/*!
+ * \brief allocate memory which lives until the arena is deposed
+ * \note  It can only be called when there is no frame allocation.
+ * \param[in] ptThis the target arena
+ * \param[in] wSize the size in bytes
+ * \param[in] wAlign the alignment, it must be 2^n
+ * \return void* the memory, NULL means the working-set is too small
+ */
+extern
+ARM_NONNULL(1)
+void *mem_arena_alloc_persistent(   mem_arena_t *ptThis, 
+                                    uint32_t wSize, 
+                                    uint32_t wAlign);
+
+/*!
+ * \brief release all frame allocations, it is usually called on each new frame
+ * \param[in] ptThis the target arena
+ */
+extern
+ARM_NONNULL(1)
+void mem_arena_reset(mem_arena_t *ptThis);
+
+/*!
+ * \brief release the arena in bulk
+ * \param[in] ptThis the target arena
+ */
+extern
+ARM_NONNULL(1)
+void mem_arena_depose(mem_arena_t *ptThis);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
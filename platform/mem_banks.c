@@ -0,0 +1,470 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*============================ INCLUDES ======================================*/
+#include "./platform.h"
+#include "./mem_banks.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_2d.h"
+#include "arm_2d_helper.h"
+
+/*============================ MACROS ========================================*/
+
+/* place the scratch memory of arm-2d in the memory banks */
+#ifndef PLATFORM_CFG_USE_BANK_ALLOCATOR
+#   define PLATFORM_CFG_USE_BANK_ALLOCATOR  1
+#endif
+
+/* the size of the fast pool in SRAM4, the core1 stack takes the rest */
+#ifndef PLATFORM_CFG_FAST_POOL_SIZE
+#   define PLATFORM_CFG_FAST_POOL_SIZE      (3 * 1024)
+#endif
+
+#define __MEM_BLOCK_UNIT                    sizeof(__mem_block_t)
+
+/* the number of arm_2d_mem_type_t: unspecified, slow and fast */
+#define __MEM_TYPE_COUNT                    3
+
+/* a tag for allocations not coming from the arm-2d scratch memory */
+#define __MEM_TYPE_NONE                     0xFF
+
+#define __MEM_STACK_PATTERN                 0xDEADBEEFul
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/* the header of a block in the fast pool, the size is in __MEM_BLOCK_UNIT */
+typedef struct __mem_block_t {
+    uint16_t hwSize;
+    uint16_t hwUsed;
+    uint32_t wType;
+} __mem_block_t;
+
+/* the header in front of each allocation in the striped heap */
+typedef struct __mem_heap_header_t {
+    void *pOrigin;
+    uint32_t wSize : 24;
+    uint32_t wType : 8;
+} __mem_heap_header_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+__attribute__((section(".bss.sram4.fast_pool")))
+static __mem_block_t s_tFastPool[PLATFORM_CFG_FAST_POOL_SIZE / sizeof(__mem_block_t)];
+
+static bool s_bFastPoolReady = false;
+
+static mem_bank_statistics_t s_tStatistics[__MEM_BANK_COUNT];
+static mem_bank_statistics_t s_tTypeStatistics[__MEM_TYPE_COUNT];
+static mem_bank_statistics_t s_tTotalStatistics;
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+static void __mem_statistics_on_alloc(  mem_bank_statistics_t *ptStatistics, 
+                                        size_t tSize)
+{
+    ptStatistics->wUsed += tSize;
+    ptStatistics->wPeak = MAX(ptStatistics->wPeak, ptStatistics->wUsed);
+    ptStatistics->wAllocations++;
+}
+
+static void __mem_bank_on_alloc(mem_bank_t tBank, 
+                                uint_fast8_t chType, 
+                                size_t tSize)
+{
+    __mem_statistics_on_alloc(&s_tStatistics[tBank], tSize);
+    __mem_statistics_on_alloc(&s_tTotalStatistics, tSize);
+    if (chType < __MEM_TYPE_COUNT) {
+        __mem_statistics_on_alloc(&s_tTypeStatistics[chType], tSize);
+    }
+}
+
+static void __mem_bank_on_free( mem_bank_t tBank, 
+                                uint_fast8_t chType, 
+                                size_t tSize)
+{
+    s_tStatistics[tBank].wUsed -= tSize;
+    s_tTotalStatistics.wUsed -= tSize;
+    if (chType < __MEM_TYPE_COUNT) {
+        s_tTypeStatistics[chType].wUsed -= tSize;
+    }
+}
+
+static bool __mem_bank_is_in_fast_pool(void *pMem)
+{
+    return  ((uintptr_t)pMem >= (uintptr_t)s_tFastPool)
+        &&  ((uintptr_t)pMem < (uintptr_t)s_tFastPool + sizeof(s_tFastPool));
+}
+
+static void *__mem_bank_fast_pool_alloc(size_t tSize, size_t tAlign)
+{
+    if (tAlign > __MEM_BLOCK_UNIT) {
+        return NULL;
+    }
+
+    if (!s_bFastPoolReady) {
+        s_bFastPoolReady = true;
+        s_tFastPool[0].hwSize = dimof(s_tFastPool);
+        s_tFastPool[0].hwUsed = 0;
+    }
+
+    /* the header is included */
+    uint_fast16_t hwUnits = (tSize + __MEM_BLOCK_UNIT - 1) / __MEM_BLOCK_UNIT + 1;
+
+    __mem_block_t *ptBlock = s_tFastPool;
+    __mem_block_t *ptEnd = &s_tFastPool[dimof(s_tFastPool)];
+
+    /* first fit */
+    for (; ptBlock < ptEnd; ptBlock += ptBlock->hwSize) {
+        if (ptBlock->hwUsed || ptBlock->hwSize < hwUnits) {
+            continue;
+        }
+
+        if (ptBlock->hwSize - hwUnits >= 2) {
+            /* split */
+            __mem_block_t *ptRemain = ptBlock + hwUnits;
+            ptRemain->hwSize = ptBlock->hwSize - hwUnits;
+            ptRemain->hwUsed = 0;
+            ptBlock->hwSize = hwUnits;
+        }
+        ptBlock->hwUsed = 1;
+
+        return (void *)(ptBlock + 1);
+    }
+
+    return NULL;
+}
+
+static uint32_t __mem_bank_fast_pool_get_largest_free(void)
+{
+    uint32_t wLargest = 0;
+
+    if (!s_bFastPoolReady) {
+        return sizeof(s_tFastPool) - __MEM_BLOCK_UNIT;
+    }
+
+    __mem_block_t *ptEnd = &s_tFastPool[dimof(s_tFastPool)];
+    for (__mem_block_t *ptBlock = s_tFastPool; 
+        ptBlock < ptEnd; 
+        ptBlock += ptBlock->hwSize) {
+        if (!ptBlock->hwUsed) {
+            wLargest = MAX(wLargest, (ptBlock->hwSize - 1) * __MEM_BLOCK_UNIT);
+        }
+    }
+
+    return wLargest;
+}
+
+static uint32_t __mem_bank_heap_get_largest_free(void)
+{
+    /* the C library has no such API, probe it with a binary search */
+    uint32_t wLow = 0;
+    uint32_t wHigh = 256 * 1024;
+
+    while (wLow < wHigh) {
+        uint32_t wSize = (wLow + wHigh + 1) >> 1;
+        void *pMem = malloc(wSize);
+        if (NULL != pMem) {
+            free(pMem);
+            wLow = wSize;
+        } else {
+            wHigh = wSize - 1;
+        }
+    }
+
+    return wLow;
+}
+
+static size_t __mem_bank_fast_pool_free(void *pMem)
+{
+    __mem_block_t *ptBlock = (__mem_block_t *)pMem - 1;
+    size_t tSize = (ptBlock->hwSize - 1) * __MEM_BLOCK_UNIT;
+
+    assert(ptBlock->hwUsed);
+    ptBlock->hwUsed = 0;
+
+    /* merge adjacent free blocks */
+    __mem_block_t *ptEnd = &s_tFastPool[dimof(s_tFastPool)];
+    for (ptBlock = s_tFastPool; ptBlock < ptEnd; ptBlock += ptBlock->hwSize) {
+        if (ptBlock->hwUsed) {
+            continue;
+        }
+        __mem_block_t *ptNext = ptBlock + ptBlock->hwSize;
+        while (ptNext < ptEnd && !ptNext->hwUsed) {
+            ptBlock->hwSize += ptNext->hwSize;
+            ptNext = ptBlock + ptBlock->hwSize;
+        }
+    }
+
+    return tSize;
+}
+
+static void *__mem_bank_alloc(  mem_bank_t tBank, 
+                                size_t tSize, 
+                                size_t tAlign, 
+                                uint_fast8_t chType)
+{
+    void *pMem = NULL;
+
+    assert(tBank < __MEM_BANK_COUNT);
+
+    /* ensure tAlign is 2^n */
+    tAlign = MAX(tAlign, sizeof(uint32_t));
+    assert(0 == (tAlign & (tAlign - 1)));
+
+    if (MEM_BANK_SRAM4 == tBank) {
+        pMem = __mem_bank_fast_pool_alloc(tSize, tAlign);
+        if (NULL != pMem) {
+            __mem_block_t *ptBlock = (__mem_block_t *)pMem - 1;
+            ptBlock->wType = chType;
+
+            /* count the actual size of the block */
+            __mem_bank_on_alloc(MEM_BANK_SRAM4, 
+                                chType,
+                                (ptBlock->hwSize - 1) * __MEM_BLOCK_UNIT);
+            return pMem;
+        }
+        s_tStatistics[MEM_BANK_SRAM4].wFailures++;
+
+        /* fall back to the striped heap */
+    }
+
+    uint8_t *pchOrigin = malloc(tSize + tAlign + sizeof(__mem_heap_header_t));
+    if (NULL == pchOrigin) {
+        s_tStatistics[MEM_BANK_STRIPED].wFailures++;
+        if (chType < __MEM_TYPE_COUNT) {
+            s_tTypeStatistics[chType].wFailures++;
+        }
+        return NULL;
+    }
+
+    uintptr_t pnAddress = (uintptr_t)pchOrigin + sizeof(__mem_heap_header_t);
+    pnAddress = (pnAddress + tAlign - 1) & ~(uintptr_t)(tAlign - 1);
+
+    __mem_heap_header_t *ptHeader = (__mem_heap_header_t *)pnAddress - 1;
+    ptHeader->pOrigin = pchOrigin;
+    ptHeader->wSize = tSize;
+    ptHeader->wType = chType;
+
+    __mem_bank_on_alloc(MEM_BANK_STRIPED, chType, tSize);
+
+    return (void *)pnAddress;
+}
+
+void *mem_bank_alloc(mem_bank_t tBank, size_t tSize, size_t tAlign)
+{
+    return __mem_bank_alloc(tBank, tSize, tAlign, __MEM_TYPE_NONE);
+}
+
+void mem_bank_free(void *pMem)
+{
+    if (NULL == pMem) {
+        return ;
+    }
+
+    if (__mem_bank_is_in_fast_pool(pMem)) {
+        uint_fast8_t chType = ((__mem_block_t *)pMem - 1)->wType;
+        __mem_bank_on_free( MEM_BANK_SRAM4, 
+                            chType, 
+                            __mem_bank_fast_pool_free(pMem));
+        return ;
+    }
+
+    __mem_heap_header_t *ptHeader = (__mem_heap_header_t *)pMem - 1;
+    __mem_bank_on_free(MEM_BANK_STRIPED, ptHeader->wType, ptHeader->wSize);
+    free(ptHeader->pOrigin);
+}
+
+mem_bank_statistics_t mem_bank_get_statistics(mem_bank_t tBank)
+{
+    assert(tBank < __MEM_BANK_COUNT);
+    mem_bank_statistics_t tStatistics = s_tStatistics[tBank];
+
+    if (MEM_BANK_SRAM4 == tBank) {
+        tStatistics.wLargestFree = __mem_bank_fast_pool_get_largest_free();
+    } else {
+        tStatistics.wLargestFree = __mem_bank_heap_get_largest_free();
+    }
+
+    return tStatistics;
+}
+
+mem_bank_statistics_t mem_type_get_statistics(uint_fast8_t chType)
+{
+    assert(chType < __MEM_TYPE_COUNT);
+    return s_tTypeStatistics[chType];
+}
+
+void mem_banks_reset_peak(void)
+{
+    arm_foreach(mem_bank_statistics_t, s_tStatistics) {
+        _->wPeak = _->wUsed;
+    }
+    arm_foreach(mem_bank_statistics_t, s_tTypeStatistics) {
+        _->wPeak = _->wUsed;
+    }
+    s_tTotalStatistics.wPeak = s_tTotalStatistics.wUsed;
+}
+
+uint32_t mem_banks_get_peak(void)
+{
+    return s_tTotalStatistics.wPeak;
+}
+
+static void __mem_stack_get_range(  uint_fast8_t chCore, 
+                                    uint32_t **ppwBase, 
+                                    uint32_t **ppwLimit)
+{
+#if defined(__PLATFORM_HOST__)
+    /* the host stacks are not placed by the scatter file, nothing to measure */
+    ARM_2D_UNUSED(chCore);
+    *ppwBase = NULL;
+    *ppwLimit = NULL;
+#else
+    extern uint32_t Image$$ARM_LIB_STACK$$ZI$$Base[];
+    extern uint32_t Image$$ARM_LIB_STACK$$ZI$$Limit[];
+    extern uint32_t Image$$ARM_LIB_STACK_ONE$$ZI$$Base[];
+    extern uint32_t Image$$ARM_LIB_STACK_ONE$$ZI$$Limit[];
+
+    if (0 == chCore) {
+        *ppwBase = Image$$ARM_LIB_STACK$$ZI$$Base;
+        *ppwLimit = Image$$ARM_LIB_STACK$$ZI$$Limit;
+    } else {
+        *ppwBase = Image$$ARM_LIB_STACK_ONE$$ZI$$Base;
+        *ppwLimit = Image$$ARM_LIB_STACK_ONE$$ZI$$Limit;
+    }
+#endif
+}
+
+void mem_stack_paint(uint_fast8_t chCore)
+{
+    uint32_t *pwBase, *pwLimit;
+    __mem_stack_get_range(chCore, &pwBase, &pwLimit);
+
+#if !defined(__PLATFORM_HOST__)
+    if (0 == chCore) {
+        /* leave a safety margin below the current stack pointer */
+        pwLimit = (uint32_t *)(__get_MSP() - 64);
+    }
+#endif
+
+    while (pwBase < pwLimit) {
+        *pwBase++ = __MEM_STACK_PATTERN;
+    }
+}
+
+mem_stack_statistics_t mem_stack_get_statistics(uint_fast8_t chCore)
+{
+    uint32_t *pwBase, *pwLimit;
+    __mem_stack_get_range(chCore, &pwBase, &pwLimit);
+
+    mem_stack_statistics_t tStatistics = {
+        .wSize = (uintptr_t)pwLimit - (uintptr_t)pwBase,
+    };
+
+    uint32_t *pwWord = pwBase;
+    while (pwWord < pwLimit && __MEM_STACK_PATTERN == *pwWord) {
+        pwWord++;
+    }
+
+    if (pwWord > pwBase) {
+        /* only a painted stack can be measured */
+        tStatistics.wPeak = (uintptr_t)pwLimit - (uintptr_t)pwWord;
+    }
+
+    return tStatistics;
+}
+
+void mem_banks_log_statistics(void)
+{
+    static const char *c_pchBankNames[] = {"SRAM0-3", "SRAM4"};
+    static const char *c_pchTypeNames[] = {"Unspecified", "Slow", "Fast"};
+
+    for (int_fast8_t n = 0; n < __MEM_BANK_COUNT; n++) {
+        mem_bank_statistics_t tStatistics = mem_bank_get_statistics(n);
+        ARM_2D_LOG_INFO(
+            STATISTICS, 
+            0, 
+            "MEMORY", 
+            "%s Used:%d Peak:%d Alloc:%d Fail:%d LargestFree:%d",
+            c_pchBankNames[n],
+            (int)tStatistics.wUsed,
+            (int)tStatistics.wPeak,
+            (int)tStatistics.wAllocations,
+            (int)tStatistics.wFailures,
+            (int)tStatistics.wLargestFree
+        );
+    }
+
+    for (int_fast8_t n = 0; n < __MEM_TYPE_COUNT; n++) {
+        mem_bank_statistics_t tStatistics = s_tTypeStatistics[n];
+        if (0 == tStatistics.wAllocations && 0 == tStatistics.wFailures) {
+            continue;
+        }
+        ARM_2D_LOG_INFO(
+            STATISTICS, 
+            0, 
+            "MEMORY", 
+            "Scratch[%s] Used:%d Peak:%d Alloc:%d Fail:%d",
+            c_pchTypeNames[n],
+            (int)tStatistics.wUsed,
+            (int)tStatistics.wPeak,
+            (int)tStatistics.wAllocations,
+            (int)tStatistics.wFailures
+        );
+    }
+
+    for (int_fast8_t n = 0; n < 2; n++) {
+        mem_stack_statistics_t tStatistics = mem_stack_get_statistics(n);
+        ARM_2D_LOG_INFO(
+            STATISTICS, 
+            0, 
+            "MEMORY", 
+            "Core%d Stack Peak:%d/%d",
+            (int)n,
+            (int)tStatistics.wPeak,
+            (int)tStatistics.wSize
+        );
+    }
+}
+
+#if PLATFORM_CFG_USE_BANK_ALLOCATOR
+void * __arm_2d_allocate_scratch_memory(uint32_t wSize, 
+                                        uint_fast8_t nAlign,
+                                        arm_2d_mem_type_t tType)
+{
+    mem_bank_t tBank = MEM_BANK_STRIPED;
+
+    if (ARM_2D_MEM_TYPE_FAST == tType) {
+        tBank = MEM_BANK_SRAM4;
+    }
+
+    return __mem_bank_alloc(tBank, wSize, nAlign, tType);
+}
+
+void __arm_2d_free_scratch_memory(  arm_2d_mem_type_t tType, 
+                                    void *pBuff)
+{
+    ARM_2D_UNUSED(tType);
+    mem_bank_free(pBuff);
+}
+#endif
@@ -0,0 +1,147 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __MEM_BANKS_H__
+#define __MEM_BANKS_H__
+
+/*============================ INCLUDES ======================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief the memory banks managed by the allocator
+ * \note  SRAM0-3 are striped and shared by the CPU and the LCD DMA which 
+ *        reads the PFBs. SRAM4 holds the core1 stack and a small pool for 
+ *        ARM_2D_MEM_TYPE_FAST buffers (e.g. IIR blur accumulators), which is
+ *        never touched by the DMA. SRAM5 is dedicated to the core0 stack.
+ */
+typedef enum {
+    MEM_BANK_STRIPED,                   //!< the heap in SRAM0-3
+    MEM_BANK_SRAM4,                     //!< the fast pool in SRAM4
+    __MEM_BANK_COUNT,
+} mem_bank_t;
+
+/*!
+ * \brief the allocation statistics of a memory bank
+ */
+typedef struct mem_bank_statistics_t {
+    uint32_t wUsed;                     //!< bytes in use
+    uint32_t wPeak;                     //!< the peak of bytes in use
+    uint32_t wAllocations;              //!< the number of successful allocations
+    uint32_t wFailures;                 //!< the number of failed allocations
+    uint32_t wLargestFree;              //!< the largest free block (banks only)
+} mem_bank_statistics_t;
+
+/*!
+ * \brief the usage of a core's stack
+ */
+typedef struct mem_stack_statistics_t {
+    uint32_t wSize;                     //!< the size of the stack
+    uint32_t wPeak;                     //!< the high-water-mark
+} mem_stack_statistics_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*!
+ * \brief allocate memory from a specific bank
+ * \param[in] tBank the target bank
+ * \param[in] tSize the size in bytes
+ * \param[in] tAlign the alignment, it must be 2^n
+ * \return void* the memory, NULL means the bank is full
+ */
+extern
+void *mem_bank_alloc(mem_bank_t tBank, size_t tSize, size_t tAlign);
+
+/*!
+ * \brief free the memory allocated by mem_bank_alloc()
+ * \param[in] pMem the target memory
+ */
+extern
+void mem_bank_free(void *pMem);
+
+/*!
+ * \brief get the allocation statistics of a bank
+ * \param[in] tBank the target bank
+ * \return mem_bank_statistics_t the statistics
+ */
+extern
+mem_bank_statistics_t mem_bank_get_statistics(mem_bank_t tBank);
+
+/*!
+ * \brief get the statistics of the arm-2d scratch memory of a given type
+ * \param[in] chType the memory type, i.e. arm_2d_mem_type_t
+ * \return mem_bank_statistics_t the statistics, wLargestFree is not used
+ */
+extern
+mem_bank_statistics_t mem_type_get_statistics(uint_fast8_t chType);
+
+/*!
+ * \brief restart the peak usage of all banks and memory types from the 
+ *        current usage, e.g. to measure the peak of a scene
+ */
+extern
+void mem_banks_reset_peak(void);
+
+/*!
+ * \brief get the peak of the bytes in use of all banks together, i.e. the 
+ *        high-water-mark since the last mem_banks_reset_peak()
+ * \note  it only reads a counter, so it is cheap enough to call per frame
+ * \return uint32_t the peak in bytes
+ */
+extern
+uint32_t mem_banks_get_peak(void);
+
+/*!
+ * \brief fill the unused part of a core's stack with a pattern, so the 
+ *        high-water-mark can be measured later.
+ * \note  For core0, call it in the main stack. For core1, call it before 
+ *        launching core1.
+ * \param[in] chCore the target core
+ */
+extern
+void mem_stack_paint(uint_fast8_t chCore);
+
+/*!
+ * \brief get the usage of a core's stack
+ * \param[in] chCore the target core
+ * \return mem_stack_statistics_t the usage
+ */
+extern
+mem_stack_statistics_t mem_stack_get_statistics(uint_fast8_t chCore);
+
+/*!
+ * \brief log the memory statistics with ARM_2D_LOG_INFO
+ */
+extern
+void mem_banks_log_statistics(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,12 +22,108 @@
 #include "arm_2d_disp_adapters.h"
 
 #include "st7789_simple.h"
+#include "spsc_queue.h"
+#include "mem_banks.h"
 
 /*============================ MACROS ========================================*/
+
+/* 
+ * When enabled, the LCD flushing is carried out on core1: core0 renders PFBs 
+ * and passes them to core1 through a lock-free spsc queue, core1 sends them 
+ * to the LCD and rings a SIO FIFO doorbell to return the PFB back to core0.
+ */
+#ifndef PLATFORM_CFG_FLUSH_ON_CORE1
+#   define PLATFORM_CFG_FLUSH_ON_CORE1          0
+#endif
+
+/* 
+ * log the statistics of the memory banks and stacks with the FPS. It is off by
+ * default, as each log probes the largest free block of the heap with about 18
+ * malloc() and free() pairs.
+ */
+#ifndef PLATFORM_CFG_LOG_MEMORY_STATISTICS
+#   define PLATFORM_CFG_LOG_MEMORY_STATISTICS   0
+#endif
+
+/* the number of in-flight PFBs, it must be 2^n */
+#ifndef PLATFORM_CFG_FLUSH_QUEUE_SIZE
+#   define PLATFORM_CFG_FLUSH_QUEUE_SIZE        4
+#endif
+
+/* 
+ * Every queued request holds a PFB until core1 pops it, hence a queue that is 
+ * not smaller than the PFB pool never overflows. It allows the flush-complete
+ * ISR, which chains the next span of the shadow framebuffer, to push without
+ * waiting.
+ */
+#if     PLATFORM_CFG_FLUSH_ON_CORE1                                             \
+    &&  PLATFORM_CFG_FLUSH_QUEUE_SIZE < __DISP0_CFG_PFB_HEAP_SIZE__
+#   error PLATFORM_CFG_FLUSH_QUEUE_SIZE must not be smaller than \
+__DISP0_CFG_PFB_HEAP_SIZE__
+#endif
+
+#if PLATFORM_CFG_FLUSH_ON_CORE1 && !__DISP0_CFG_ENABLE_ASYNC_FLUSHING__
+#   error PLATFORM_CFG_FLUSH_ON_CORE1 requires \
+__DISP0_CFG_ENABLE_ASYNC_FLUSHING__ to be enabled in arm_2d_disp_adapter_0.h
+#endif
+
+#if PLATFORM_CFG_FLUSH_ON_CORE1
+#   include "pico/multicore.h"
+#endif
+
+#if     __DISP0_CFG_VIRTUAL_RESOURCE_HELPER__                                   \
+    &&  __DISP0_CFG_VRES_CACHE_SIZE__ > 0                                       \
+    &&  __DISP0_CFG_VRES_PREFETCH__
+#   define __PLATFORM_VRES_PREFETCH__       1
+#   include "hardware/dma.h"
+#else
+#   define __PLATFORM_VRES_PREFETCH__       0
+#endif
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
+
+#if PLATFORM_CFG_FLUSH_ON_CORE1
+typedef struct __flush_request_t {
+    const uint8_t *pchBuffer;
+    int16_t iX;
+    int16_t iY;
+    int16_t iWidth;
+    int16_t iHeight;
+} __flush_request_t;
+#endif
+
 /*============================ GLOBAL VARIABLES ==============================*/
 /*============================ LOCAL VARIABLES ===============================*/
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+static alarm_id_t s_tGovernorAlarm = 0;
+#endif
+
+#if __PLATFORM_VRES_PREFETCH__
+/* a spare DMA channel copies the prefetched rows one by one */
+static struct {
+    int nChannel;
+    uintptr_t pSrc;
+    uintptr_t pDes;
+    uint32_t wSourceStride;
+    uint32_t wTargetStride;
+    uint32_t wBytesPerLine;
+    volatile int16_t iRowsLeft;
+} s_tVRESPrefetch = {
+    .nChannel = -1,
+};
+#endif
+
+static volatile uint32_t s_wLCDBusBytes = 0;
+
+#if PLATFORM_CFG_FLUSH_ON_CORE1
+static struct {
+    spsc_queue_t tQueue;                /* core0 (producer) -> core1 (consumer) */
+    __flush_request_t tBuffer[PLATFORM_CFG_FLUSH_QUEUE_SIZE];
+} s_tFlush;
+#endif
+
 /*============================ PROTOTYPES ====================================*/
 /*============================ IMPLEMENTATION ================================*/
 
@@ -42,6 +138,7 @@ void Disp0_DrawBitmap(  int16_t x,
                         int16_t height, 
                         const uint8_t *pchBitmap)
 {
+    s_wLCDBusBytes += (uint32_t)width * (uint32_t)height * sizeof(uint16_t);
     st7789_draw_bitmap(x, y, width, height, pchBitmap);
 }
 
@@ -54,19 +151,206 @@ void __disp_adapter0_request_async_flushing(void *pTarget,
                                             int16_t iHeight,
                                             const uint16_t *phwBuffer)
 {
+    s_wLCDBusBytes += (uint32_t)iWidth * (uint32_t)iHeight * sizeof(uint16_t);
+
+#if PLATFORM_CFG_FLUSH_ON_CORE1
+    __flush_request_t tRequest = {
+        .pchBuffer = (const uint8_t *)phwBuffer,
+        .iX = iX,
+        .iY = iY,
+        .iWidth = iWidth,
+        .iHeight = iHeight,
+    };
+
+    /* 
+     * the PFB is owned by core1 from now on until the doorbell rings. 
+     * NOTE: it might run in the flush-complete ISR, never wait here. The queue 
+     *       is sized to hold every PFB, so the push cannot fail.
+     */
+    bool bQueued = spsc_queue_push(&s_tFlush.tQueue, &tRequest);
+    assert(bQueued);
+    ARM_2D_UNUSED(bQueued);
+    __SEV();
+#else
     st7789_draw_bitmap_async(iX, iY, iWidth, iHeight, (const uint8_t *)phwBuffer);
+#endif
 }
 
+#if PLATFORM_CFG_FLUSH_ON_CORE1
+static void __core1_flush_task(void)
+{
+    while(true) {
+        __flush_request_t tRequest;
+
+        while(!spsc_queue_pop(&s_tFlush.tQueue, &tRequest)) {
+            __WFE();
+        }
+
+        st7789_draw_bitmap( tRequest.iX, 
+                            tRequest.iY, 
+                            tRequest.iWidth, 
+                            tRequest.iHeight, 
+                            tRequest.pchBuffer);
+
+        /* ring the doorbell: return the PFB to core0 */
+        multicore_fifo_push_blocking((uint32_t)tRequest.pchBuffer);
+    }
+}
+
+static void __sio_proc0_irq_handler(void)
+{
+    /* 
+     * the PFB pool is only touched on core0, hence the PFB is freed here 
+     * rather than on core1
+     */
+    while(multicore_fifo_rvalid()) {
+        (void)multicore_fifo_pop_blocking();
+        disp_adapter0_insert_async_flushing_complete_event_handler();
+    }
+
+    multicore_fifo_clear_irq();
+}
+#else
 void st7789_insert_async_flush_cpl_evt_handler(void)
 {
     disp_adapter0_insert_async_flushing_complete_event_handler();
 }
 #endif
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+static int64_t __governor_alarm_handler(alarm_id_t tID, void *pUserData)
+{
+    ARM_2D_UNUSED(tID);
+    ARM_2D_UNUSED(pUserData);
+
+    /* the interrupt itself wakes up the CPU from __WFE() */
+    s_tGovernorAlarm = 0;
+    return 0;
+}
+
+void __disp_adapter0_governor_request_wakeup(uint32_t wUS)
+{
+    if (s_tGovernorAlarm > 0) {
+        cancel_alarm(s_tGovernorAlarm);
+    }
+    s_tGovernorAlarm = add_alarm_in_us(wUS, &__governor_alarm_handler, NULL, true);
+}
+#endif
+
+#if __PLATFORM_VRES_PREFETCH__
+static void __vres_prefetch_dma_irq_handler(void)
+{
+    uint_fast8_t chChannel = (uint_fast8_t)s_tVRESPrefetch.nChannel;
+    if (!dma_channel_get_irq1_status(chChannel)) {
+        return ;
+    }
+    dma_channel_acknowledge_irq1(chChannel);
+
+    if (--s_tVRESPrefetch.iRowsLeft > 0) {
+        s_tVRESPrefetch.pSrc += s_tVRESPrefetch.wSourceStride;
+        s_tVRESPrefetch.pDes += s_tVRESPrefetch.wTargetStride;
+
+        dma_channel_set_write_addr(chChannel, (void *)s_tVRESPrefetch.pDes, false);
+        dma_channel_set_trans_count(chChannel, s_tVRESPrefetch.wBytesPerLine, false);
+        dma_channel_set_read_addr(chChannel, (const void *)s_tVRESPrefetch.pSrc, true);
+    } else {
+        disp_adapter0_vres_insert_prefetch_complete_event_handler();
+    }
+}
+
+/* NOTE: the assets are expected to be memory mapped, e.g. in the XIP flash */
+arm_2d_err_t __disp_adapter0_vres_request_async_copy(   uintptr_t pObj,
+                                                        uintptr_t pSrc,
+                                                        uint32_t wSourceStride,
+                                                        uintptr_t pDes,
+                                                        uint32_t wTargetStride,
+                                                        uint32_t wBytesPerLine,
+                                                        int16_t iHeight)
+{
+    ARM_2D_UNUSED(pObj);
+
+    if (s_tVRESPrefetch.nChannel < 0) {
+        s_tVRESPrefetch.nChannel = dma_claim_unused_channel(false);
+        if (s_tVRESPrefetch.nChannel < 0) {
+            /* no spare DMA channel */
+            return ARM_2D_ERR_NOT_SUPPORT;
+        }
+
+        dma_channel_config tCFG 
+            = dma_channel_get_default_config(s_tVRESPrefetch.nChannel);
+        channel_config_set_transfer_data_size(&tCFG, DMA_SIZE_8);
+        channel_config_set_read_increment(&tCFG, true);
+        channel_config_set_write_increment(&tCFG, true);
+        dma_channel_set_config(s_tVRESPrefetch.nChannel, &tCFG, false);
+
+        dma_channel_set_irq1_enabled(s_tVRESPrefetch.nChannel, true);
+        irq_add_shared_handler( DMA_IRQ_1, 
+                                &__vres_prefetch_dma_irq_handler,
+                                PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_1, true);
+    }
+
+    if (iHeight <= 0) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    if (dma_channel_is_busy(s_tVRESPrefetch.nChannel)) {
+        /* the ISR is still copying the rows of the previous request */
+        return ARM_2D_ERR_BUSY;
+    }
+
+    if (wSourceStride == wBytesPerLine && wTargetStride == wBytesPerLine) {
+        /* the rows are contiguous */
+        wBytesPerLine *= iHeight;
+        iHeight = 1;
+    }
+
+    s_tVRESPrefetch.pSrc = pSrc;
+    s_tVRESPrefetch.pDes = pDes;
+    s_tVRESPrefetch.wSourceStride = wSourceStride;
+    s_tVRESPrefetch.wTargetStride = wTargetStride;
+    s_tVRESPrefetch.wBytesPerLine = wBytesPerLine;
+    s_tVRESPrefetch.iRowsLeft = iHeight;
+
+    dma_channel_set_write_addr(s_tVRESPrefetch.nChannel, (void *)pDes, false);
+    dma_channel_set_trans_count(s_tVRESPrefetch.nChannel, wBytesPerLine, false);
+    dma_channel_set_read_addr(s_tVRESPrefetch.nChannel, (const void *)pSrc, true);
+
+    return ARM_2D_ERR_NONE;
+}
+#endif
+
+#if PLATFORM_CFG_LOG_MEMORY_STATISTICS
+void __disp_adapter0_user_log_statistics(void)
+{
+    mem_banks_log_statistics();
+}
+#endif
+
+uint32_t platform_get_lcd_bus_bytes(void)
+{
+    return s_wLCDBusBytes;
+}
+
+uint32_t platform_get_memory_peak(void)
+{
+    return mem_banks_get_peak();
+}
+
+void platform_reset_memory_peak(void)
+{
+    mem_banks_reset_peak();
+}
 
 void platform_init(void)
 {
     extern void SystemCoreClockUpdate();
 
+    /* measure the high-water-mark of the stacks */
+    mem_stack_paint(0);
+    mem_stack_paint(1);
+
     SystemCoreClockUpdate();
     /*! \note if you do want to use SysTick in your application, please use 
      *!       init_cycle_counter(true); 
@@ -81,4 +365,17 @@ void platform_init(void)
     stdio_init_all();
 
     st7789_init();
+
+#if PLATFORM_CFG_FLUSH_ON_CORE1
+    spsc_queue_init(&s_tFlush.tQueue, 
+                    s_tFlush.tBuffer, 
+                    sizeof(__flush_request_t), 
+                    dimof(s_tFlush.tBuffer));
+
+    multicore_launch_core1(&__core1_flush_task);
+
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(SIO_IRQ_PROC0, &__sio_proc0_irq_handler);
+    irq_set_enabled(SIO_IRQ_PROC0, true);
+#endif
 }
\ No newline at end of file
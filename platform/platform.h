@@ -29,7 +29,9 @@
 #include <stdbool.h>
 #include <assert.h>
 
-#include "pico/stdlib.h"
+#if !defined(__PLATFORM_HOST__)
+#   include "pico/stdlib.h"
+#endif
 #include "perf_counter.h"
 
 #if defined(RTE_Compiler_EventRecorder) || defined(RTE_CMSIS_View_EventRecorder)
@@ -50,6 +52,24 @@ extern "C" {
 
 extern void platform_init(void);
 
+/*!
+ * \brief get the number of bytes sent to the LCD since power-on
+ * \return uint32_t the number of bytes (wraps around)
+ */
+extern uint32_t platform_get_lcd_bus_bytes(void);
+
+/*!
+ * \brief get the peak usage of the scratch memory, i.e. the high-water-mark
+ *        of the bytes in use of all banks together
+ * \return uint32_t the peak usage in bytes
+ */
+extern uint32_t platform_get_memory_peak(void);
+
+/*!
+ * \brief restart the peak usage of the scratch memory from the current usage
+ */
+extern void platform_reset_memory_peak(void);
+
 
 #ifdef   __cplusplus
 }
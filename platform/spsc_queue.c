@@ -0,0 +1,102 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*============================ INCLUDES ======================================*/
+#include "spsc_queue.h"
+
+#include <string.h>
+#include <assert.h>
+
+/*============================ MACROS ========================================*/
+
+/* make sure the item is visible to the other core before the index is, 
+ * __DMB() is an inline function in CMSIS, so it cannot be detected with 
+ * defined(). The fence is a DMB on Cortex-M0+ and works on the host, too.
+ */
+#define __SPSC_QUEUE_BARRIER()          __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ IMPLEMENTATION ================================*/
+
+void spsc_queue_init(   spsc_queue_t *ptThis, 
+                        void *pBuffer, 
+                        uint16_t hwItemSize, 
+                        uint16_t hwItemCount)
+{
+    assert(NULL != ptThis);
+    assert(NULL != pBuffer);
+    assert(hwItemSize > 0);
+
+    /* ensure hwItemCount is 2^n */
+    assert((hwItemCount > 0) && (0 == (hwItemCount & (hwItemCount - 1))));
+
+    ptThis->pchBuffer = (uint8_t *)pBuffer;
+    ptThis->hwItemSize = hwItemSize;
+    ptThis->hwItemCount = hwItemCount;
+    ptThis->hwHead = 0;
+    ptThis->hwTail = 0;
+}
+
+bool spsc_queue_push(spsc_queue_t *ptThis, const void *pItem)
+{
+    uint16_t hwHead = ptThis->hwHead;
+
+    if ((uint16_t)(hwHead - ptThis->hwTail) >= ptThis->hwItemCount) {
+        /* full */
+        return false;
+    }
+
+    memcpy( &ptThis->pchBuffer[ (hwHead & (ptThis->hwItemCount - 1)) 
+                              * ptThis->hwItemSize],
+            pItem,
+            ptThis->hwItemSize);
+
+    __SPSC_QUEUE_BARRIER();
+    ptThis->hwHead = hwHead + 1;
+
+    return true;
+}
+
+bool spsc_queue_pop(spsc_queue_t *ptThis, void *pItem)
+{
+    uint16_t hwTail = ptThis->hwTail;
+
+    if (hwTail == ptThis->hwHead) {
+        /* empty */
+        return false;
+    }
+
+    __SPSC_QUEUE_BARRIER();
+    memcpy( pItem,
+            &ptThis->pchBuffer[ (hwTail & (ptThis->hwItemCount - 1)) 
+                              * ptThis->hwItemSize],
+            ptThis->hwItemSize);
+
+    __SPSC_QUEUE_BARRIER();
+    ptThis->hwTail = hwTail + 1;
+
+    return true;
+}
+
+uint_fast16_t spsc_queue_get_count(spsc_queue_t *ptThis)
+{
+    return (uint16_t)(ptThis->hwHead - ptThis->hwTail);
+}
@@ -0,0 +1,97 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __SPSC_QUEUE_H__
+#define __SPSC_QUEUE_H__
+
+/*============================ INCLUDES ======================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief a lock-free single-producer/single-consumer ring of fixed-size items
+ * \note hwHead is only written by the producer and hwTail is only written by
+ *       the consumer, hence no lock is required when the producer and the 
+ *       consumer run on different cores (or in thread and ISR context).
+ */
+typedef struct spsc_queue_t {
+    uint8_t *pchBuffer;
+    uint16_t hwItemSize;
+    uint16_t hwItemCount;               /* must be 2^n */
+    volatile uint16_t hwHead;           /* free-running, producer only */
+    volatile uint16_t hwTail;           /* free-running, consumer only */
+} spsc_queue_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*!
+ * \brief initialize a spsc queue
+ * \param[in] ptThis the target queue
+ * \param[in] pBuffer a buffer of (hwItemSize * hwItemCount) bytes
+ * \param[in] hwItemSize the size of each item
+ * \param[in] hwItemCount the number of items, it must be 2^n
+ */
+extern
+void spsc_queue_init(   spsc_queue_t *ptThis, 
+                        void *pBuffer, 
+                        uint16_t hwItemSize, 
+                        uint16_t hwItemCount);
+
+/*!
+ * \brief add an item to the queue. It is ONLY called by the producer.
+ * \param[in] ptThis the target queue
+ * \param[in] pItem the item to copy into the queue
+ * \retval true the item is added
+ * \retval false the queue is full
+ */
+extern
+bool spsc_queue_push(spsc_queue_t *ptThis, const void *pItem);
+
+/*!
+ * \brief remove an item from the queue. It is ONLY called by the consumer.
+ * \param[in] ptThis the target queue
+ * \param[out] pItem the buffer to hold the item
+ * \retval true an item is fetched
+ * \retval false the queue is empty
+ */
+extern
+bool spsc_queue_pop(spsc_queue_t *ptThis, void *pItem);
+
+/*!
+ * \brief get the number of items in the queue
+ * \param[in] ptThis the target queue
+ * \return uint_fast16_t the number of items
+ */
+extern
+uint_fast16_t spsc_queue_get_count(spsc_queue_t *ptThis);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,94 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __ARM_2D_USER_OPCODE_COMMON_H__
+#define __ARM_2D_USER_OPCODE_COMMON_H__
+
+/*============================ INCLUDES ======================================*/
+
+#include "arm_2d.h"
+#include "__arm_2d_example_opcodes_common.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*
+ * The op indexes of the user opcodes added by this project, which follow the
+ * ones of the example user opcodes (__ARM_2D_OP_IDX_USER_DRAW_LINE and
+ * __ARM_2D_OP_IDX_USER_DRAW_CIRCLE)
+ */
+enum {
+    __ARM_2D_OP_IDX_USER_DRAW_CIRCLES = __ARM_2D_OP_IDX_USER_DRAW_CIRCLE + 1,
+    __ARM_2D_OP_IDX_USER_DRAW_ARC,
+    __ARM_2D_OP_IDX_USER_DRAW_LINES,
+    __ARM_2D_OP_IDX_USER_DRAW_THICK_LINE,
+    __ARM_2D_OP_IDX_USER_FILL_POLYGON,
+    __ARM_2D_OP_IDX_USER_FILL_RADIAL_GRADIENT,
+};
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief integer square root, i.e. floor(sqrt(wValue))
+ */
+__STATIC_INLINE
+uint32_t __arm_2d_user_isqrt(uint32_t wValue)
+{
+    uint32_t wResult = 0;
+    uint32_t wBit = 1ul << 30;
+
+    while (wBit > wValue) {
+        wBit >>= 2;
+    }
+
+    while (wBit) {
+        if (wValue >= wResult + wBit) {
+            wValue -= wResult + wBit;
+            wResult = (wResult >> 1) + wBit;
+        } else {
+            wResult >>= 1;
+        }
+        wBit >>= 2;
+    }
+
+    return wResult;
+}
+
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* __ARM_2D_USER_OPCODE_COMMON_H__ */
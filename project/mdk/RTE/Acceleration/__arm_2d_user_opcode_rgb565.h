@@ -0,0 +1,159 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __ARM_2D_USER_OPCODE_RGB565_H__
+#define __ARM_2D_USER_OPCODE_RGB565_H__
+
+/*============================ INCLUDES ======================================*/
+
+#include "arm_2d.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+
+/*============================ MACROS ========================================*/
+
+/*
+ * Two RGB565 pixels in a word, P1:P0, are split into two words, each keeps
+ * 3 channels with at least 5 bits of headroom above every channel:
+ *
+ *   word & 0x07E0F81F          G1 (21~26)  R0 (11~15)  B0 (0~4)
+ *   (word >> 5) & 0x07C0F83F   R1 (22~26)  B1 (11~15)  G0 (0~5)
+ *
+ * so both can be multiplied by an opacity of 0 ~ 32 in one go. A single pixel
+ * uses the first layout with (pixel | pixel << 16).
+ */
+#define __ARM_2D_USER_RGB565_SPLIT_MASK_A       0x07E0F81Ful
+#define __ARM_2D_USER_RGB565_SPLIT_MASK_B       0x07C0F83Ful
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/* two pixels in a word, it may alias the uint16_t pixels of a tile */
+#if defined(__GNUC__) || defined(__clang__)
+typedef uint32_t __arm_2d_user_rgb565_pair_t __attribute__((__may_alias__));
+#else
+typedef uint32_t __arm_2d_user_rgb565_pair_t;
+#endif
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief blend a span of RGB565 pixels with the same colour and opacity, two
+ *        pixels per word load and store
+ * \note the opacity is rounded to 1/32 steps, i.e. (chOpacity + 4) >> 3, so
+ *       an opacity below 4 draws nothing and 252 or above is opaque
+ * \param[in] phwTarget the first pixel of the span, any alignment
+ * \param[in] nCount the number of pixels
+ * \param[in] hwColour the colour
+ * \param[in] chOpacity the opacity
+ */
+__STATIC_INLINE
+void __arm_2d_user_rgb565_fill_span_opa(uint16_t *__RESTRICT phwTarget,
+                                        int32_t nCount,
+                                        uint16_t hwColour,
+                                        uint8_t chOpacity)
+{
+    uint32_t wOpacity = ((uint32_t)chOpacity + 4) >> 3;
+
+    if (nCount <= 0 || 0 == wOpacity) {
+        return ;
+    }
+
+    uint32_t wColour = (uint32_t)hwColour | ((uint32_t)hwColour << 16);
+
+    if (32 == wOpacity) {
+        if ((uintptr_t)phwTarget & 0x02) {
+            *phwTarget++ = hwColour;
+            nCount--;
+        }
+
+        __arm_2d_user_rgb565_pair_t *pwTarget = (__arm_2d_user_rgb565_pair_t *)phwTarget;
+        for (int32_t n = nCount >> 1; n > 0; n--) {
+            *pwTarget++ = wColour;
+        }
+
+        if (nCount & 0x01) {
+            *(uint16_t *)pwTarget = hwColour;
+        }
+        return ;
+    }
+
+    uint32_t wTransparency = 32 - wOpacity;
+
+    /* the colour part of the blending is the same for every pixel */
+    uint32_t wColourA = (wColour & __ARM_2D_USER_RGB565_SPLIT_MASK_A) * wOpacity;
+    uint32_t wColourB = ((wColour >> 5) & __ARM_2D_USER_RGB565_SPLIT_MASK_B) * wOpacity;
+
+    /* the unaligned first pixel */
+    if ((uintptr_t)phwTarget & 0x02) {
+        uint32_t wPixel = *phwTarget;
+        wPixel = (wPixel | (wPixel << 16)) & __ARM_2D_USER_RGB565_SPLIT_MASK_A;
+        wPixel = ((wPixel * wTransparency + wColourA) >> 5) & __ARM_2D_USER_RGB565_SPLIT_MASK_A;
+        *phwTarget++ = (uint16_t)(wPixel | (wPixel >> 16));
+        nCount--;
+    }
+
+    __arm_2d_user_rgb565_pair_t *pwTarget = (__arm_2d_user_rgb565_pair_t *)phwTarget;
+
+    for (int32_t n = nCount >> 1; n > 0; n--) {
+        uint32_t wPixels = *pwTarget;
+
+        uint32_t wA = wPixels & __ARM_2D_USER_RGB565_SPLIT_MASK_A;
+        uint32_t wB = (wPixels >> 5) & __ARM_2D_USER_RGB565_SPLIT_MASK_B;
+
+        wA = ((wA * wTransparency + wColourA) >> 5) & __ARM_2D_USER_RGB565_SPLIT_MASK_A;
+        wB = ((wB * wTransparency + wColourB) >> 5) & __ARM_2D_USER_RGB565_SPLIT_MASK_B;
+
+        *pwTarget++ = wA | (wB << 5);
+    }
+
+    /* the last pixel left */
+    if (nCount & 0x01) {
+        uint16_t *phwPixel = (uint16_t *)pwTarget;
+        uint32_t wPixel = *phwPixel;
+        wPixel = (wPixel | (wPixel << 16)) & __ARM_2D_USER_RGB565_SPLIT_MASK_A;
+        wPixel = ((wPixel * wTransparency + wColourA) >> 5) & __ARM_2D_USER_RGB565_SPLIT_MASK_A;
+        *phwPixel = (uint16_t)(wPixel | (wPixel >> 16));
+    }
+}
+
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+
+#endif /* __ARM_2D_USER_OPCODE_RGB565_H__ */
@@ -87,12 +87,114 @@
 
 #endif
 
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+#   if __DISP0_CFG_ENABLE_3FB_HELPER_SERVICE__
+#       error The shadow framebuffer mode cannot be used with the 3FB helper service.
+#   endif
+
+#   if      __DISP0_CFG_ROTATE_SCREEN__ == 1                                   \
+        ||  __DISP0_CFG_ROTATE_SCREEN__ == 3
+#       define __DISP0_SHADOW_FB_WIDTH__        __DISP0_CFG_SCEEN_HEIGHT__
+#       define __DISP0_SHADOW_FB_HEIGHT__       __DISP0_CFG_SCEEN_WIDTH__
+#       define __DISP0_SHADOW_FB_MAX_SPANS__    __DISP0_CFG_PFB_BLOCK_WIDTH__
+#   else
+#       define __DISP0_SHADOW_FB_WIDTH__        __DISP0_CFG_SCEEN_WIDTH__
+#       define __DISP0_SHADOW_FB_HEIGHT__       __DISP0_CFG_SCEEN_HEIGHT__
+#       define __DISP0_SHADOW_FB_MAX_SPANS__    __DISP0_CFG_PFB_BLOCK_HEIGHT__
+#   endif
+#endif
+
+#if     __DISP0_CFG_VIRTUAL_RESOURCE_HELPER__                                   \
+    &&  __DISP0_CFG_VRES_CACHE_SIZE__ > 0                                       \
+    &&  !__DISP0_CFG_USE_HEAP_FOR_VIRTUAL_RESOURCE_HELPER__
+#   error The virtual resource cache requires __DISP0_CFG_USE_HEAP_FOR_VIRTUAL_RESOURCE_HELPER__ to be enabled.
+#endif
+
+#if __DISP0_CFG_VIRTUAL_RESOURCE_HELPER__ && __DISP0_CFG_VRES_CACHE_SIZE__ > 0
+#   define __DISP0_VRES_USE_CACHE__     1
+#else
+#   define __DISP0_VRES_USE_CACHE__     0
+#endif
+
+#if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+#   define __DISP0_PFB_POOL_TAKE()      __disp_adapter0_pfb_pool_update(1)
+#   define __DISP0_PFB_POOL_GIVE()      __disp_adapter0_pfb_pool_update(-1)
+#else
+#   define __DISP0_PFB_POOL_TAKE()      do {} while(0)
+#   define __DISP0_PFB_POOL_GIVE()      do {} while(0)
+#endif
+
+#if __DISP0_VRES_USE_CACHE__ && __DISP0_CFG_VRES_PREFETCH__
+#   define __DISP0_VRES_USE_PREFETCH__  1
+#else
+#   define __DISP0_VRES_USE_PREFETCH__  0
+#endif
+
+#if __DISP0_CFG_NAVIGATION_LAYER_MODE__ && __DISP0_CFG_NAVIGATION_LAYER_CACHE__
+#   define __DISP0_NAV_USE_CACHE__      1
+#   if __DISP0_CFG_NAVIGATION_LAYER_MODE__ == 2
+#       define __DISP0_NAV_CACHE_WIDTH__    100
+#       define __DISP0_NAV_CACHE_HEIGHT__   24
+#   else
+#       define __DISP0_NAV_CACHE_WIDTH__    __DISP0_CFG_SCEEN_WIDTH__
+#       define __DISP0_NAV_CACHE_HEIGHT__   8
+#   endif
+#else
+#   define __DISP0_NAV_USE_CACHE__      0
+#endif
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
+
+#if __DISP0_VRES_USE_CACHE__
+/* a region of an asset kept in the virtual resource cache */
+typedef struct __disp_adapter0_vres_cache_item_t {
+    uintptr_t pAsset;
+    arm_2d_region_t tRegion;
+    void *pBuffer;
+    uint32_t wSize;
+    uint32_t wLastUsed;
+    uint16_t hwReference;
+    volatile bool bReady;               /* false when a prefetch is on-going */
+    bool bPrefetched;
+} __disp_adapter0_vres_cache_item_t;
+#endif
+
+#if __DISP0_VRES_USE_PREFETCH__
+/* an entry of the access log, it contains everything to load the region again */
+typedef struct __disp_adapter0_vres_access_t {
+    uintptr_t pObj;
+    uintptr_t pAsset;
+    arm_2d_region_t tRegion;
+    uint32_t wSourceStride;
+    uint32_t wBytesPerLine;
+    uint16_t hwPixelSize;
+} __disp_adapter0_vres_access_t;
+#endif
+
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+/* a changed span (or a group of contiguous full rows) inside a PFB */
+typedef struct __disp_adapter0_span_t {
+    const COLOUR_INT *ptBuffer;
+    int16_t iX;
+    int16_t iY;
+    int16_t iWidth;
+    int16_t iHeight;
+} __disp_adapter0_span_t;
+#endif
+
 /*============================ GLOBAL VARIABLES ==============================*/
 extern uint32_t SystemCoreClock;
 
 /*============================ PROTOTYPES ====================================*/
+#if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+static void __disp_adapter0_pfb_pool_update(int_fast8_t chDelta);
+#endif
+
+#if __DISP0_VRES_USE_PREFETCH__
+static void __disp_adapter0_vres_prefetch_on_frame_complete(void);
+#endif
+
 extern 
 int32_t Disp0_DrawBitmap(int16_t x, 
                         int16_t y, 
@@ -126,6 +228,118 @@ static
 arm_2d_helper_3fb_t s_tDirectModeHelper;
 #endif
 
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+ARM_NOINIT
+static
+struct {
+    COLOUR_INT tBuffer[__DISP0_SHADOW_FB_WIDTH__ * __DISP0_SHADOW_FB_HEIGHT__];
+    __disp_adapter0_span_t tSpans[__DISP0_SHADOW_FB_MAX_SPANS__];
+    void *pTarget;
+    volatile uint16_t hwCount;
+    volatile uint16_t hwIndex;
+    bool bIsNewFrame;
+    bool bValid;
+} s_tShadowFB;
+#endif
+
+#if __DISP0_NAV_USE_CACHE__
+/* the text of the navigation layer, the background is keyed out when blitting */
+ARM_NOINIT
+static
+struct {
+    COLOUR_INT tBuffer[__DISP0_NAV_CACHE_WIDTH__ * __DISP0_NAV_CACHE_HEIGHT__];
+    arm_2d_tile_t tTile;
+    uint32_t wAverage;
+    uint32_t wLCDLatency;
+    float fCPUUsage;
+    bool bValid;
+} s_tNavCache;
+#endif
+
+#if __DISP0_VRES_USE_CACHE__
+static
+struct {
+    __disp_adapter0_vres_cache_item_t tItems[__DISP0_CFG_VRES_CACHE_ITEM_COUNT__];
+    uint32_t wUsedSize;
+    uint32_t wTick;
+} s_tVRESCache;
+#endif
+
+#if __DISP0_VRES_USE_PREFETCH__
+static
+struct {
+    /* [0] or [1] is the log of the current frame, the other one is the 
+     * log of the previous frame used for prediction 
+     */
+    __disp_adapter0_vres_access_t tLog[2][__DISP0_CFG_VRES_PREFETCH_LOG_SIZE__];
+    uint16_t hwCount[2];
+    uint8_t chCurrent;
+    uint16_t hwCursor;                  /* the search start in the previous log */
+    __disp_adapter0_vres_cache_item_t * volatile ptPending;
+    bool bUnsupported;
+    disp_adapter0_vres_statistics_t tStatistics;
+} s_tVRESPrefetch;
+#endif
+
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+/* the off-screen buffers of the static layers, never taken from the heap */
+ARM_NOINIT
+static
+struct {
+    uint64_t dwBuffer[(__DISP0_CFG_STATIC_LAYER_CACHE_POOL_SIZE__ + 7) / 8];
+} s_tLayerCachePool;
+
+/* the layers holding a buffer, sorted by the buffer address */
+static disp_adapter0_layer_cache_t *s_ptLayerCacheList = NULL;
+#endif
+
+#if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+static
+struct {
+    volatile uint16_t hwHeld;
+    uint16_t hwPeak;
+} s_tPFBPool;
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+static
+struct {
+    uint32_t wBins[__DISP0_LATENCY_TYPE_COUNT][__DISP0_CFG_HISTOGRAM_BINS__];
+    uint32_t wOverflows[__DISP0_LATENCY_TYPE_COUNT];
+    uint32_t wSamples;
+    uint32_t wSkipped;
+} s_tHistogram;
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+static
+struct {
+    int64_t lNextFrame;
+    int64_t lFramePeriod;
+    uint16_t hwTargetFPS;
+    bool bInFrame;
+
+    /* frame jitter: the delay between the frame slot and the frame start */
+    struct {
+        int32_t nMin;
+        int32_t nMax;
+        int64_t lTotal;
+        uint16_t hwCount;
+    } Jitter;
+} s_tGovernor;
+#endif
+
+#if __DISP0_CFG_VIRTUAL_TIMEBASE__
+static
+struct {
+    int64_t lVirtualTime;
+    int64_t lFrameStart;
+    int32_t nFrameCycles;
+    uint32_t wFrameNumber;
+    bool bEnabled;
+} s_tTimebase;
+#endif
+
 #if __DISP0_CFG_USE_CONSOLE__
 static 
 struct {
@@ -178,6 +392,96 @@ IMPL_PFB_ON_DRAW(__pfb_draw_handler)
 
 #if __DISP0_CFG_NAVIGATION_LAYER_MODE__
 
+/*!
+ * \brief print the real-time FPS info (and the version) of the navigation layer
+ * \param[in] ptTile the target tile, i.e. a PFB or the navigation cache
+ * \param[in] ptRegion the draw region of the text, NULL means the whole tile
+ * \param[in] iRow the text row of the status bar inside the draw region
+ */
+static void __disp_adapter0_print_navigation(const arm_2d_tile_t *ptTile,
+                                             const arm_2d_region_t *ptRegion,
+                                             int16_t iRow)
+{
+    ARM_2D_UNUSED(iRow);
+
+    arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
+    arm_lcd_text_set_draw_region((arm_2d_region_t *)ptRegion);
+
+#if __DISP0_CFG_NAVIGATION_LAYER_MODE__ == 2
+    /* round mode */
+    if (__DISP0_CFG_ITERATION_CNT__) {
+
+    #if __DISP0_CFG_COLOUR_DEPTH__ == 8
+        arm_lcd_text_set_colour(GLCD_COLOR_LIGHT_GREY, GLCD_COLOR_BLACK);
+    #else
+        arm_lcd_text_set_colour(GLCD_COLOR_GREEN, GLCD_COLOR_BLACK);
+    #endif
+
+        arm_lcd_text_location(0,0);
+        if (DISP0_ADAPTER.Benchmark.wAverage) {
+            arm_lcd_printf(
+                "  FPS:%3"PRIu32":%"PRIu32"ms\r\n",
+                MIN(arm_2d_helper_get_reference_clock_frequency() / DISP0_ADAPTER.Benchmark.wAverage, 999),
+                (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wAverage));
+        }
+        arm_lcd_printf( 
+            "  CPU:%2.2f%% \r\n", 
+            DISP0_ADAPTER.Benchmark.fCPUUsage);
+
+        arm_lcd_printf( 
+            "  LCD:%2"PRIu32"ms",
+            (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wLCDLatency) );
+        
+    }
+#else
+    /* draw real-time FPS info */
+    if (__DISP0_CFG_ITERATION_CNT__) {
+
+    #if __DISP0_CFG_COLOUR_DEPTH__ == 8
+        arm_lcd_text_set_colour(GLCD_COLOR_LIGHT_GREY, GLCD_COLOR_BLACK);
+    #else
+        arm_lcd_text_set_colour(GLCD_COLOR_GREEN, GLCD_COLOR_BLACK);
+    #endif
+        arm_lcd_text_location(iRow, 0);
+
+        if (DISP0_ADAPTER.Benchmark.wAverage) {
+            arm_lcd_printf(
+                "FPS:%3"PRIu32":%"PRIu32"ms ",
+                MIN(arm_2d_helper_get_reference_clock_frequency() / DISP0_ADAPTER.Benchmark.wAverage, 999),
+                (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wAverage));
+        }
+
+#if __DISP0_CFG_SCEEN_WIDTH__ >= 240
+        arm_lcd_printf( 
+            "CPU:%2.2f%% LCD-Latency:%2"PRIu32"ms", 
+            DISP0_ADAPTER.Benchmark.fCPUUsage,
+            (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wLCDLatency));
+#else
+        arm_lcd_printf( 
+            "LCD:%2"PRIu32"ms",
+            (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wLCDLatency) );
+#endif
+    }
+
+#if __DISP0_CFG_SCEEN_WIDTH__ >= 320 
+
+    /* draw verion info on the bottom right corner */
+    arm_lcd_text_set_colour(GLCD_COLOR_LIGHT_GREY, GLCD_COLOR_WHITE);
+    arm_lcd_text_location( iRow, 
+                            (__DISP0_CFG_SCEEN_WIDTH__ / 6) - 12);
+    arm_lcd_printf("v" 
+                    ARM_TO_STRING(ARM_2D_VERSION_MAJOR)
+                    "."
+                    ARM_TO_STRING(ARM_2D_VERSION_MINOR)
+                    "."
+                    ARM_TO_STRING(ARM_2D_VERSION_PATCH)
+                    " "
+                    ARM_2D_VERSION_STR
+                    );
+#endif
+#endif
+}
+
 __WEAK 
 IMPL_PFB_ON_DRAW(__disp_adapter0_user_draw_navigation)
 {
@@ -262,13 +566,10 @@ IMPL_PFB_ON_DRAW(__disp_adapter0_draw_navigation)
     arm_lcd_text_set_char_spacing(0);
     arm_lcd_text_set_line_spacing(0);
     arm_lcd_text_set_display_mode(ARM_2D_DRW_PATN_MODE_COPY);
+    arm_lcd_text_set_font(&ARM_2D_FONT_6x8.use_as__arm_2d_font_t);
 
 #if __DISP0_CFG_NAVIGATION_LAYER_MODE__ == 2
     /* round mode */
-    arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
-    arm_lcd_text_set_font(&ARM_2D_FONT_6x8.use_as__arm_2d_font_t);
-    arm_lcd_text_set_draw_region(&(s_tNavDirtyRegionList[0].tRegion));
-    
     if (__DISP0_CFG_ITERATION_CNT__) {
         draw_round_corner_box(  ptTile, 
                                 &(s_tNavDirtyRegionList[0].tRegion), 
@@ -276,34 +577,8 @@ IMPL_PFB_ON_DRAW(__disp_adapter0_draw_navigation)
                                 255-32);
 
         ARM_2D_OP_WAIT_ASYNC();
-
-    #if __DISP0_CFG_COLOUR_DEPTH__ == 8
-        arm_lcd_text_set_colour(GLCD_COLOR_LIGHT_GREY, GLCD_COLOR_BLACK);
-    #else
-        arm_lcd_text_set_colour(GLCD_COLOR_GREEN, GLCD_COLOR_BLACK);
-    #endif
-
-        arm_lcd_text_location(0,0);
-        if (DISP0_ADAPTER.Benchmark.wAverage) {
-            arm_lcd_printf(
-                "  FPS:%3"PRIu32":%"PRIu32"ms\r\n",
-                MIN(arm_2d_helper_get_reference_clock_frequency() / DISP0_ADAPTER.Benchmark.wAverage, 999),
-                (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wAverage));
-        }
-        arm_lcd_printf( 
-            "  CPU:%2.2f%% \r\n", 
-            DISP0_ADAPTER.Benchmark.fCPUUsage);
-
-        arm_lcd_printf( 
-            "  LCD:%2"PRIu32"ms",
-            (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wLCDLatency) );
-        
     }
 #else
-    arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
-    arm_lcd_text_set_font(&ARM_2D_FONT_6x8.use_as__arm_2d_font_t);
-    arm_lcd_text_set_draw_region(NULL);
-
     /* draw real-time FPS info */
     if (__DISP0_CFG_ITERATION_CNT__) {
         arm_2dp_fill_colour_with_opacity(
@@ -324,57 +599,150 @@ IMPL_PFB_ON_DRAW(__disp_adapter0_draw_navigation)
                     255 - 32);
 
         ARM_2D_OP_WAIT_ASYNC();
+    }
+#endif
 
-    #if __DISP0_CFG_COLOUR_DEPTH__ == 8
-        arm_lcd_text_set_colour(GLCD_COLOR_LIGHT_GREY, GLCD_COLOR_BLACK);
-    #else
-        arm_lcd_text_set_colour(GLCD_COLOR_GREEN, GLCD_COLOR_BLACK);
-    #endif
-        arm_lcd_text_location((__DISP0_CFG_SCEEN_HEIGHT__ + 7) / 8 - 2,
-                              0);
-
-        if (DISP0_ADAPTER.Benchmark.wAverage) {
-            arm_lcd_printf(
-                "FPS:%3"PRIu32":%"PRIu32"ms ",
-                MIN(arm_2d_helper_get_reference_clock_frequency() / DISP0_ADAPTER.Benchmark.wAverage, 999),
-                (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wAverage));
+#if __DISP0_NAV_USE_CACHE__
+    if (bIsNewFrame) {
+        /* only render the text again when the numbers change */
+        if (    !s_tNavCache.bValid
+            ||  s_tNavCache.wAverage != DISP0_ADAPTER.Benchmark.wAverage
+            ||  s_tNavCache.wLCDLatency != DISP0_ADAPTER.Benchmark.wLCDLatency
+            ||  s_tNavCache.fCPUUsage != DISP0_ADAPTER.Benchmark.fCPUUsage) {
+
+            s_tNavCache.wAverage = DISP0_ADAPTER.Benchmark.wAverage;
+            s_tNavCache.wLCDLatency = DISP0_ADAPTER.Benchmark.wLCDLatency;
+            s_tNavCache.fCPUUsage = DISP0_ADAPTER.Benchmark.fCPUUsage;
+
+            /* the key colour, i.e. transparent */
+            arm_2d_fill_colour( &s_tNavCache.tTile, 
+                                NULL, 
+                                (__arm_2d_color_t){GLCD_COLOR_BLACK});
+            ARM_2D_OP_WAIT_ASYNC();
+
+            __disp_adapter0_print_navigation(   &s_tNavCache.tTile,
+                                                &s_tNavCache.tTile.tRegion,
+                                                0);
+            ARM_2D_OP_WAIT_ASYNC();
+
+            s_tNavCache.bValid = true;
         }
+    }
 
-#if __DISP0_CFG_SCEEN_WIDTH__ >= 240
-        arm_lcd_printf( 
-            "CPU:%2.2f%% LCD-Latency:%2"PRIu32"ms", 
-            DISP0_ADAPTER.Benchmark.fCPUUsage,
-            (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wLCDLatency));
+    do {
+    #if __DISP0_CFG_NAVIGATION_LAYER_MODE__ == 2
+        const arm_2d_region_t *ptRegion = &(s_tNavDirtyRegionList[0].tRegion);
+    #else
+        const arm_2d_region_t *ptRegion = (arm_2d_region_t []){
+            {
+                .tLocation = {
+                    .iX = 0,
+                    .iY = ((__DISP0_CFG_SCEEN_HEIGHT__ + 7) / 8 - 2) * 8},
+                .tSize = {
+                    .iWidth = __DISP0_NAV_CACHE_WIDTH__,
+                    .iHeight = __DISP0_NAV_CACHE_HEIGHT__,
+                },
+            },
+        };
+    #endif
+        arm_2d_tile_copy_with_colour_keying_only(
+                                        &s_tNavCache.tTile,
+                                        ptTile,
+                                        ptRegion,
+                                        (__arm_2d_color_t){GLCD_COLOR_BLACK});
+    } while(0);
+#elif __DISP0_CFG_NAVIGATION_LAYER_MODE__ == 2
+    __disp_adapter0_print_navigation(   ptTile, 
+                                        &(s_tNavDirtyRegionList[0].tRegion),
+                                        0);
 #else
-        arm_lcd_printf( 
-            "LCD:%2"PRIu32"ms",
-            (uint32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wLCDLatency) );
+    __disp_adapter0_print_navigation(   ptTile, 
+                                        NULL,
+                                        (__DISP0_CFG_SCEEN_HEIGHT__ + 7) / 8 - 2);
 #endif
-    }
-
-#if __DISP0_CFG_SCEEN_WIDTH__ >= 320 
 
-    /* draw verion info on the bottom right corner */
-    arm_lcd_text_set_colour(GLCD_COLOR_LIGHT_GREY, GLCD_COLOR_WHITE);
-    arm_lcd_text_location( (__DISP0_CFG_SCEEN_HEIGHT__ + 7) / 8 - 2, 
-                            (__DISP0_CFG_SCEEN_WIDTH__ / 6) - 12);
-    arm_lcd_printf("v" 
-                    ARM_TO_STRING(ARM_2D_VERSION_MAJOR)
-                    "."
-                    ARM_TO_STRING(ARM_2D_VERSION_MINOR)
-                    "."
-                    ARM_TO_STRING(ARM_2D_VERSION_PATCH)
-                    " "
-                    ARM_2D_VERSION_STR
-                    );
-#endif
-#endif
     ARM_2D_OP_WAIT_ASYNC();
 
     return arm_fsm_rt_cpl;
 }
 #endif
 
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+/*!
+ * \brief compare a PFB with the shadow framebuffer row by row, update the 
+ *        shadow framebuffer and generate a list of changed spans.
+ * \param[in] ptTile the PFB tile
+ * \return uint_fast16_t the number of spans to flush
+ */
+static uint_fast16_t __disp_adapter0_shadow_fb_diff(const arm_2d_tile_t *ptTile)
+{
+    int16_t iPFBWidth = ptTile->tRegion.tSize.iWidth;
+    int16_t iPFBHeight = ptTile->tRegion.tSize.iHeight;
+    int16_t iX0 = ptTile->tRegion.tLocation.iX;
+    int16_t iY0 = ptTile->tRegion.tLocation.iY;
+
+    assert(iPFBHeight <= __DISP0_SHADOW_FB_MAX_SPANS__);
+
+    const COLOUR_INT *ptSource = (const COLOUR_INT *)ptTile->pchBuffer;
+    COLOUR_INT *ptShadow 
+        = &s_tShadowFB.tBuffer[iY0 * __DISP0_SHADOW_FB_WIDTH__ + iX0];
+    __disp_adapter0_span_t *ptLast = NULL;
+    uint_fast16_t hwCount = 0;
+
+    for (int_fast16_t iY = 0; 
+        iY < iPFBHeight; 
+        iY++, ptSource += iPFBWidth, ptShadow += __DISP0_SHADOW_FB_WIDTH__) {
+
+        int_fast16_t iLeft = 0;
+        int_fast16_t iRight = iPFBWidth - 1;
+
+        if (s_tShadowFB.bValid) {
+            while ((iLeft <= iRight) && (ptSource[iLeft] == ptShadow[iLeft])) {
+                iLeft++;
+            }
+            if (iLeft > iRight) {
+                /* nothing changed in this row */
+                ptLast = NULL;
+                continue;
+            }
+            while (ptSource[iRight] == ptShadow[iRight]) {
+                iRight--;
+            }
+
+            /* the LCD driver requires a word aligned buffer address */
+            if ((((uintptr_t)&ptSource[iLeft]) & 0x03) && (iLeft > 0)) {
+                iLeft--;
+            }
+        }
+
+        int16_t iWidth = iRight - iLeft + 1;
+
+        memcpy( &ptShadow[iLeft], 
+                &ptSource[iLeft], 
+                (size_t)iWidth * sizeof(COLOUR_INT));
+
+        if ((NULL != ptLast) 
+        &&  (iWidth == iPFBWidth) 
+        &&  (ptLast->iWidth == iPFBWidth)) {
+            /* full rows are contiguous in the PFB, merge them */
+            ptLast->iHeight++;
+            continue;
+        }
+
+        ptLast = &s_tShadowFB.tSpans[hwCount++];
+        *ptLast = (__disp_adapter0_span_t) {
+            .ptBuffer = &ptSource[iLeft],
+            .iX = iX0 + iLeft,
+            .iY = iY0 + iY,
+            .iWidth = iWidth,
+            .iHeight = 1,
+        };
+    }
+
+    return hwCount;
+}
+#endif
+
 #if __DISP0_CFG_ENABLE_3FB_HELPER_SERVICE__
 __WEAK
 IMPL_PFB_ON_LOW_LV_RENDERING(__disp_adapter0_pfb_render_handler)
@@ -431,9 +799,34 @@ void disp_adapter0_insert_dma_copy_complete_event_handler(void)
  * framerate. 
  */
 
-void disp_adapter0_insert_async_flushing_complete_event_handler(void)
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+static void __disp_adapter0_shadow_fb_flush_next_span(void)
 {
-    arm_2d_helper_pfb_report_rendering_complete(
+    uint_fast16_t hwIndex = s_tShadowFB.hwIndex++;
+    __disp_adapter0_span_t *ptSpan = &s_tShadowFB.tSpans[hwIndex];
+
+    __disp_adapter0_request_async_flushing(
+                    s_tShadowFB.pTarget,
+                    s_tShadowFB.bIsNewFrame && (0 == hwIndex),
+                    ptSpan->iX,
+                    ptSpan->iY,
+                    ptSpan->iWidth,
+                    ptSpan->iHeight,
+                    ptSpan->ptBuffer);
+}
+#endif
+
+void disp_adapter0_insert_async_flushing_complete_event_handler(void)
+{
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+    if (s_tShadowFB.hwIndex < s_tShadowFB.hwCount) {
+        /* flush the next changed span */
+        __disp_adapter0_shadow_fb_flush_next_span();
+        return ;
+    }
+#endif
+    __DISP0_PFB_POOL_GIVE();
+    arm_2d_helper_pfb_report_rendering_complete(
                     &DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t);
 }
 
@@ -445,6 +838,24 @@ IMPL_PFB_ON_LOW_LV_RENDERING(__disp_adapter0_pfb_render_handler)
     ARM_2D_PARAM(pTarget);
     ARM_2D_PARAM(bIsNewFrame);
 
+    /* the PFB is held until the flushing is complete */
+    __DISP0_PFB_POOL_TAKE();
+
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+    s_tShadowFB.pTarget = pTarget;
+    s_tShadowFB.bIsNewFrame = bIsNewFrame;
+    s_tShadowFB.hwIndex = 0;
+    s_tShadowFB.hwCount = __disp_adapter0_shadow_fb_diff(ptTile);
+
+    if (0 == s_tShadowFB.hwCount) {
+        /* nothing changed */
+        __DISP0_PFB_POOL_GIVE();
+        arm_2d_helper_pfb_report_rendering_complete(
+                        &DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t);
+    } else {
+        __disp_adapter0_shadow_fb_flush_next_span();
+    }
+#else
     /* request an asynchronous flushing */
     __disp_adapter0_request_async_flushing(
                     pTarget,
@@ -454,7 +865,7 @@ IMPL_PFB_ON_LOW_LV_RENDERING(__disp_adapter0_pfb_render_handler)
                     ptTile->tRegion.tSize.iWidth,
                     ptTile->tRegion.tSize.iHeight,
                     (const COLOUR_INT *)ptTile->pchBuffer);
-
+#endif
 }
 
 #   else
@@ -471,11 +882,24 @@ IMPL_PFB_ON_LOW_LV_RENDERING(__disp_adapter0_pfb_render_handler)
     ARM_2D_PARAM(pTarget);
     ARM_2D_PARAM(bIsNewFrame);
 
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+    uint_fast16_t hwCount = __disp_adapter0_shadow_fb_diff(ptTile);
+
+    for (uint_fast16_t n = 0; n < hwCount; n++) {
+        __disp_adapter0_span_t *ptSpan = &s_tShadowFB.tSpans[n];
+        Disp0_DrawBitmap(ptSpan->iX,
+                        ptSpan->iY,
+                        ptSpan->iWidth,
+                        ptSpan->iHeight,
+                        (const uint8_t *)ptSpan->ptBuffer);
+    }
+#else
     Disp0_DrawBitmap(ptTile->tRegion.tLocation.iX,
                     ptTile->tRegion.tLocation.iY,
                     ptTile->tRegion.tSize.iWidth,
                     ptTile->tRegion.tSize.iHeight,
                     (const uint8_t *)ptTile->pchBuffer);
+#endif
 
     arm_2d_helper_pfb_report_rendering_complete(
                     &DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t);
@@ -483,6 +907,34 @@ IMPL_PFB_ON_LOW_LV_RENDERING(__disp_adapter0_pfb_render_handler)
 #   endif
 #endif
 
+#if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+static void __disp_adapter0_pfb_pool_update(int_fast8_t chDelta)
+{
+    uint32_t wPRIMASK = __get_PRIMASK();
+    __disable_irq();
+
+    s_tPFBPool.hwHeld += chDelta;
+    /* the PFB being rendered is also in use */
+    s_tPFBPool.hwPeak = MAX(s_tPFBPool.hwPeak, s_tPFBPool.hwHeld + 1);
+
+    __set_PRIMASK(wPRIMASK);
+}
+
+disp_adapter0_pfb_pool_statistics_t disp_adapter0_get_pfb_pool_statistics(void)
+{
+    return (disp_adapter0_pfb_pool_statistics_t) {
+        .hwPoolSize = __DISP0_CFG_PFB_HEAP_SIZE__,
+        .hwHeld = s_tPFBPool.hwHeld,
+        .hwPeak = s_tPFBPool.hwPeak,
+    };
+}
+#endif
+
+__WEAK
+void __disp_adapter0_user_log_statistics(void)
+{
+}
+
 __WEAK 
 void __disp_adapter0_user_on_frame_complete(void *ptTarget, 
                                                      bool bIsFrameSkipped)
@@ -492,6 +944,150 @@ void __disp_adapter0_user_on_frame_complete(void *ptTarget,
 
 }
 
+#if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+static void __disp_adapter0_histogram_add(  disp_adapter0_latency_t tType, 
+                                            int32_t nTicks)
+{
+    int32_t nIndex = (int32_t)arm_2d_helper_convert_ticks_to_ms(MAX(nTicks, 0))
+                   / __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__;
+
+    /* 32-bit bins take more than two years at 60 FPS to overflow */
+    if (nIndex >= __DISP0_CFG_HISTOGRAM_BINS__) {
+        s_tHistogram.wOverflows[tType]++;
+    } else {
+        s_tHistogram.wBins[tType][nIndex]++;
+    }
+}
+
+uint32_t disp_adapter0_get_latency_percentile(disp_adapter0_latency_t tType,
+                                              uint_fast8_t chPercent)
+{
+    assert(tType < __DISP0_LATENCY_TYPE_COUNT);
+
+    uint32_t wTotal = s_tHistogram.wOverflows[tType];
+    for (int_fast16_t n = 0; n < __DISP0_CFG_HISTOGRAM_BINS__; n++) {
+        wTotal += s_tHistogram.wBins[tType][n];
+    }
+    if (0 == wTotal) {
+        return 0;
+    }
+
+    /* the rank of the sample, rounded up */
+    uint32_t wRank = (wTotal * MIN(chPercent, 100) + 99) / 100;
+    uint32_t wCount = 0;
+    for (int_fast16_t n = 0; n < __DISP0_CFG_HISTOGRAM_BINS__; n++) {
+        wCount += s_tHistogram.wBins[tType][n];
+        if (wCount >= wRank) {
+            return (uint32_t)(n + 1) * __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__;
+        }
+    }
+
+    /* the sample is in the overflows, its latency is unknown */
+    return DISP0_LATENCY_OVERFLOW;
+}
+
+uint32_t disp_adapter0_get_latency_overflow_count(disp_adapter0_latency_t tType)
+{
+    assert(tType < __DISP0_LATENCY_TYPE_COUNT);
+
+    return s_tHistogram.wOverflows[tType];
+}
+
+static 
+const char *__disp_adapter0_percentile_to_string(   char *pchBuffer,
+                                                    size_t tSize,
+                                                    disp_adapter0_latency_t tType,
+                                                    uint_fast8_t chPercent)
+{
+    uint32_t wLatency = disp_adapter0_get_latency_percentile(tType, chPercent);
+
+    if (DISP0_LATENCY_OVERFLOW == wLatency) {
+        snprintf(pchBuffer, tSize, ">%d", 
+                (int)(  __DISP0_CFG_HISTOGRAM_BINS__ 
+                     *  __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__));
+    } else {
+        snprintf(pchBuffer, tSize, "%d", (int)wLatency);
+    }
+
+    return pchBuffer;
+}
+
+static void __disp_adapter0_log_latency_percentiles(void)
+{
+    static const char *c_pchNames[] = {"Frame", "Render", "Flush"};
+
+    for (int_fast8_t n = 0; n < __DISP0_LATENCY_TYPE_COUNT; n++) {
+        char chP50[12], chP95[12], chP99[12];
+
+        ARM_2D_LOG_INFO(
+            STATISTICS, 
+            0, 
+            "DISP_ADAPTER0", 
+            "%s(ms) p50:%s p95:%s p99:%s Overflow:%d",
+            c_pchNames[n],
+            __disp_adapter0_percentile_to_string(chP50, sizeof(chP50), n, 50),
+            __disp_adapter0_percentile_to_string(chP95, sizeof(chP95), n, 95),
+            __disp_adapter0_percentile_to_string(chP99, sizeof(chP99), n, 99),
+            (int)s_tHistogram.wOverflows[n]
+        );
+    }
+}
+
+uint32_t disp_adapter0_get_skipped_frame_count(void)
+{
+    return s_tHistogram.wSkipped;
+}
+
+void disp_adapter0_reset_frame_statistics(void)
+{
+    memset(&s_tHistogram, 0, sizeof(s_tHistogram));
+}
+
+void disp_adapter0_dump_frame_statistics(void)
+{
+    printf("# frames:%u skipped:%u\r\n", 
+            (unsigned)s_tHistogram.wSamples, 
+            (unsigned)s_tHistogram.wSkipped);
+    printf("bin_ms,frame,render,flush\r\n");
+
+    for (int_fast16_t n = 0; n < __DISP0_CFG_HISTOGRAM_BINS__; n++) {
+        if (    0 == s_tHistogram.wBins[DISP0_LATENCY_FRAME][n]
+           &&   0 == s_tHistogram.wBins[DISP0_LATENCY_RENDER][n]
+           &&   0 == s_tHistogram.wBins[DISP0_LATENCY_FLUSH][n]) {
+            continue;
+        }
+        printf("%d,%u,%u,%u\r\n",
+                (int)(n * __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__),
+                (unsigned)s_tHistogram.wBins[DISP0_LATENCY_FRAME][n],
+                (unsigned)s_tHistogram.wBins[DISP0_LATENCY_RENDER][n],
+                (unsigned)s_tHistogram.wBins[DISP0_LATENCY_FLUSH][n]);
+    }
+
+    /* the samples beyond the range of the histogram */
+    printf(">=%d,%u,%u,%u\r\n",
+            (int)(__DISP0_CFG_HISTOGRAM_BINS__ * __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__),
+            (unsigned)s_tHistogram.wOverflows[DISP0_LATENCY_FRAME],
+            (unsigned)s_tHistogram.wOverflows[DISP0_LATENCY_RENDER],
+            (unsigned)s_tHistogram.wOverflows[DISP0_LATENCY_FLUSH]);
+}
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+static int32_t __disp_adapter0_ticks_to_us(int32_t nTicks)
+{
+    return (int32_t)(   (int64_t)nTicks * 1000000ll 
+                    /   (int64_t)arm_2d_helper_get_reference_clock_frequency());
+}
+
+static void __disp_adapter0_governor_reset_jitter(void)
+{
+    s_tGovernor.Jitter.nMin = INT32_MAX;
+    s_tGovernor.Jitter.nMax = 0;
+    s_tGovernor.Jitter.lTotal = 0;
+    s_tGovernor.Jitter.hwCount = 0;
+}
+#endif
+
 static bool __on_each_frame_complete(void *ptTarget)
 {
     ARM_2D_PARAM(ptTarget);
@@ -517,6 +1113,23 @@ static bool __on_each_frame_complete(void *ptTarget)
     int32_t nTotalLCDCycCount = DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t.Statistics.nRenderingCycle;
     DISP0_ADAPTER.Benchmark.wLCDLatency = nTotalLCDCycCount;
 
+#if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+    if (bIsFrameSkipped) {
+        s_tHistogram.wSkipped++;
+    } else {
+        s_tHistogram.wSamples++;
+        if (nElapsed > 0) {
+            __disp_adapter0_histogram_add(DISP0_LATENCY_FRAME, nElapsed);
+        }
+        /* the total cycle is the rendering plus the waiting for the flushing */
+        __disp_adapter0_histogram_add(DISP0_LATENCY_RENDER, nTotalLCDCycCount);
+        __disp_adapter0_histogram_add(
+            DISP0_LATENCY_FLUSH, 
+            DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t.Statistics.nTotalCycle
+        -   nTotalLCDCycCount);
+    }
+#endif
+
     /* calculate real-time FPS */
     if (__DISP0_CFG_ITERATION_CNT__) {
         if (DISP0_ADAPTER.Benchmark.hwIterations) {
@@ -544,6 +1157,48 @@ static bool __on_each_frame_complete(void *ptTarget)
                 }
 
                 /* log statistics */
+            #if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+                __disp_adapter0_log_latency_percentiles();
+                ARM_2D_LOG_INFO(
+                    STATISTICS, 
+                    0, 
+                    "DISP_ADAPTER0", 
+                    "Skipped:%d",
+                    (int)s_tHistogram.wSkipped
+                );
+            #endif
+            #if __DISP0_VRES_USE_PREFETCH__
+                ARM_2D_LOG_INFO(
+                    STATISTICS, 
+                    0, 
+                    "DISP_ADAPTER0", 
+                    "VRES Hit:%d Miss:%d\tPrefetch:%d Used:%d Late:%d",
+                    (int)s_tVRESPrefetch.tStatistics.wHit,
+                    (int)s_tVRESPrefetch.tStatistics.wMiss,
+                    (int)s_tVRESPrefetch.tStatistics.wPrefetch,
+                    (int)s_tVRESPrefetch.tStatistics.wPrefetchHit,
+                    (int)s_tVRESPrefetch.tStatistics.wPrefetchLate
+                );
+            #endif
+
+            #if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+                if (s_tGovernor.hwTargetFPS && s_tGovernor.Jitter.hwCount) {
+                    ARM_2D_LOG_INFO(
+                        STATISTICS, 
+                        0, 
+                        "DISP_ADAPTER0", 
+                        "Governor:%dFPS\tJitter(us) min:%d max:%d avg:%d",
+                        s_tGovernor.hwTargetFPS,
+                        __disp_adapter0_ticks_to_us(s_tGovernor.Jitter.nMin),
+                        __disp_adapter0_ticks_to_us(s_tGovernor.Jitter.nMax),
+                        __disp_adapter0_ticks_to_us(
+                            (int32_t)(  s_tGovernor.Jitter.lTotal 
+                                     /  s_tGovernor.Jitter.hwCount))
+                    );
+                }
+                __disp_adapter0_governor_reset_jitter();
+            #endif
+
                 if (DISP0_ADAPTER.Benchmark.wAverage) {
                     ARM_2D_LOG_INFO(
                         STATISTICS, 
@@ -565,6 +1220,18 @@ static bool __on_each_frame_complete(void *ptTarget)
                         (int32_t)arm_2d_helper_convert_ticks_to_ms(DISP0_ADAPTER.Benchmark.wLCDLatency)
                     );
                 }
+
+            #if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+                ARM_2D_LOG_INFO(
+                    STATISTICS, 
+                    0, 
+                    "DISP_ADAPTER0", 
+                    "PFB Pool Peak:%d/%d",
+                    (int)s_tPFBPool.hwPeak,
+                    (int)__DISP0_CFG_PFB_HEAP_SIZE__
+                );
+            #endif
+                __disp_adapter0_user_log_statistics();
                  
                 DISP0_ADAPTER.Benchmark.wMin = UINT32_MAX;
                 DISP0_ADAPTER.Benchmark.wMax = 0;
@@ -583,7 +1250,29 @@ static bool __on_each_frame_complete(void *ptTarget)
         arm_2d_helper_3fb_flush_frame(&s_tDirectModeHelper);
     }
 #endif
+
+#if __DISP0_VRES_USE_PREFETCH__
+    __disp_adapter0_vres_prefetch_on_frame_complete();
+#endif
+
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+    /* the first frame is a full-screen refresh, the shadow is in sync since then */
+    if (!bIsFrameSkipped) {
+        s_tShadowFB.bValid = true;
+    }
+#endif
     
+#if __DISP0_CFG_VIRTUAL_TIMEBASE__
+    s_tTimebase.nFrameCycles = (int32_t)(lTimeStamp - s_tTimebase.lFrameStart);
+    s_tTimebase.lFrameStart = 0;
+    s_tTimebase.wFrameNumber++;
+
+    /* advance a fixed step per frame, skipped or not */
+    s_tTimebase.lVirtualTime 
+        +=  arm_2d_helper_get_reference_clock_frequency() 
+        /   __DISP0_CFG_VIRTUAL_TIMEBASE_FPS__;
+#endif
+
     __disp_adapter0_user_on_frame_complete(ptTarget, bIsFrameSkipped);
     
     return true;
@@ -757,6 +1446,29 @@ static void __user_scene_player_init(void)
     DISP0_ADAPTER.Benchmark.wMin = UINT32_MAX;
     DISP0_ADAPTER.Benchmark.hwIterations = __DISP0_CFG_ITERATION_CNT__;
     DISP0_ADAPTER.Benchmark.hwFrameCounter = 0;
+
+#if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+    disp_adapter0_reset_frame_statistics();
+#endif
+
+#if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+    s_tPFBPool.hwHeld = 0;
+    s_tPFBPool.hwPeak = 0;
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+    s_tGovernor.hwTargetFPS = 0;
+    s_tGovernor.lFramePeriod = 0;
+    s_tGovernor.lNextFrame = 0;
+    s_tGovernor.bInFrame = false;
+    __disp_adapter0_governor_reset_jitter();
+#endif
+
+#if __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+    s_tShadowFB.bValid = false;
+    s_tShadowFB.hwCount = 0;
+    s_tShadowFB.hwIndex = 0;
+#endif
 }
 
 #if __DISP0_CFG_NAVIGATION_LAYER_MODE__
@@ -772,6 +1484,26 @@ void disp_adapter0_navigator_init(void)
 
     ARM_2D_UNUSED(tScreen);
 
+#if __DISP0_NAV_USE_CACHE__
+    s_tNavCache.tTile = (arm_2d_tile_t) {
+        .tRegion = {
+            .tSize = {
+                .iWidth = __DISP0_NAV_CACHE_WIDTH__,
+                .iHeight = __DISP0_NAV_CACHE_HEIGHT__,
+            },
+        },
+        .tInfo = {
+            .bIsRoot = true,
+            .bHasEnforcedColour = true,
+            .tColourInfo = {
+                .chScheme = __DISP0_COLOUR_FORMAT__,
+            },
+        },
+        .pchBuffer = (uint8_t *)s_tNavCache.tBuffer,
+    };
+    s_tNavCache.bValid = false;
+#endif
+
 #if __DISP0_CFG_NAVIGATION_LAYER_MODE__ == 2
     
 
@@ -958,10 +1690,448 @@ void disp_adapter0_init(void)
 #endif
 }
 
+#if __DISP0_CFG_VIRTUAL_TIMEBASE__
+
+static void __disp_adapter0_timebase_on_task(void)
+{
+    if (0 == s_tTimebase.lFrameStart) {
+        s_tTimebase.lFrameStart = arm_2d_helper_get_system_timestamp();
+    }
+}
+
+void disp_adapter0_set_virtual_timebase(bool bEnable)
+{
+    /* start from a fixed, non-zero origin, as 0 means "not initialised" for
+     * the timestamps used with arm_2d_helper_is_time_out()
+     */
+    s_tTimebase.lVirtualTime = arm_2d_helper_get_reference_clock_frequency();
+    s_tTimebase.wFrameNumber = 0;
+    s_tTimebase.bEnabled = bEnable;
+}
+
+bool disp_adapter0_is_virtual_timebase_enabled(void)
+{
+    return s_tTimebase.bEnabled;
+}
+
+uint32_t disp_adapter0_get_frame_number(void)
+{
+    return s_tTimebase.wFrameNumber;
+}
+
+int32_t disp_adapter0_get_frame_cycles(void)
+{
+    return s_tTimebase.nFrameCycles;
+}
+
+int64_t disp_adapter0_get_scene_timestamp(void)
+{
+    if (s_tTimebase.bEnabled) {
+        return s_tTimebase.lVirtualTime;
+    }
+    return arm_2d_helper_get_system_timestamp();
+}
+
+bool disp_adapter0_scene_is_time_out(uint32_t wPeriodMS, int64_t *plTimestamp)
+{
+    assert(NULL != plTimestamp);
+
+    int64_t lNow = disp_adapter0_get_scene_timestamp();
+    int64_t lPeriod = arm_2d_helper_convert_ms_to_ticks(wPeriodMS);
+
+    if (0 == *plTimestamp) {
+        *plTimestamp = lNow + lPeriod;
+        return false;
+    }
+
+    if (lNow >= *plTimestamp) {
+        *plTimestamp = lNow + lPeriod;
+        return true;
+    }
+
+    return false;
+}
+
+/* the ticks passed since a slider started, 0 in *plTimestamp starts it */
+static int64_t __disp_adapter0_scene_slider_elapsed(int64_t *plTimestamp)
+{
+    assert(NULL != plTimestamp);
+
+    int64_t lNow = disp_adapter0_get_scene_timestamp();
+
+    /* the virtual time goes back to its origin on a scene switch */
+    if (0 == *plTimestamp || lNow < *plTimestamp) {
+        *plTimestamp = lNow;
+    }
+
+    return lNow - *plTimestamp;
+}
+
+bool disp_adapter0_scene_time_liner_slider_i64( int64_t lFrom,
+                                                int64_t lTo,
+                                                uint32_t wPeriodMS,
+                                                int64_t *plStride,
+                                                int64_t *plTimestamp)
+{
+    assert(NULL != plStride);
+
+    int64_t lPeriod = arm_2d_helper_convert_ms_to_ticks(wPeriodMS);
+    int64_t lElapsed = __disp_adapter0_scene_slider_elapsed(plTimestamp);
+
+    if (lElapsed >= lPeriod) {
+        *plStride = lTo;
+        return true;
+    }
+
+    *plStride = lFrom + (lTo - lFrom) * lElapsed / lPeriod;
+    return false;
+}
+
+bool disp_adapter0_scene_time_liner_slider( int32_t nFrom,
+                                            int32_t nTo,
+                                            uint32_t wPeriodMS,
+                                            int32_t *pnStride,
+                                            int64_t *plTimestamp)
+{
+    assert(NULL != pnStride);
+
+    int64_t lStride;
+    bool bFinished = disp_adapter0_scene_time_liner_slider_i64(
+                                                            nFrom,
+                                                            nTo,
+                                                            wPeriodMS,
+                                                            &lStride,
+                                                            plTimestamp);
+    *pnStride = (int32_t)lStride;
+    return bFinished;
+}
+
+bool disp_adapter0_scene_time_half_cos_slider(  int32_t nFrom,
+                                                int32_t nTo,
+                                                uint32_t wPeriodMS,
+                                                int32_t *pnStride,
+                                                int64_t *plTimestamp)
+{
+    assert(NULL != pnStride);
+
+    int64_t lPeriod = arm_2d_helper_convert_ms_to_ticks(wPeriodMS);
+    int64_t lElapsed = __disp_adapter0_scene_slider_elapsed(plTimestamp);
+
+    if (lElapsed >= lPeriod) {
+        *pnStride = nTo;
+        return true;
+    }
+
+    float fRatio = (float)lElapsed / (float)lPeriod;
+    fRatio = (1.0f - arm_cos_f32(ARM_2D_ANGLE(fRatio * 180.0f))) * 0.5f;
+
+    *pnStride = nFrom + (int32_t)((float)(nTo - nFrom) * fRatio);
+    return false;
+}
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+
+__WEAK
+void __disp_adapter0_governor_request_wakeup(uint32_t wUS)
+{
+    ARM_2D_UNUSED(wUS);
+}
+
+void disp_adapter0_set_target_fps(uint_fast16_t hwFPS)
+{
+    s_tGovernor.hwTargetFPS = hwFPS;
+
+    if (0 == hwFPS) {
+        s_tGovernor.lFramePeriod = 0;
+    } else {
+        s_tGovernor.lFramePeriod 
+            = arm_2d_helper_get_reference_clock_frequency() / hwFPS;
+    }
+
+    /* start from a new frame slot */
+    s_tGovernor.lNextFrame = 0;
+    __disp_adapter0_governor_reset_jitter();
+}
+
+uint_fast16_t disp_adapter0_get_target_fps(void)
+{
+    return s_tGovernor.hwTargetFPS;
+}
+
 arm_fsm_rt_t __disp_adapter0_task(void)
 {
+    arm_fsm_rt_t tResult;
+
+    if (!s_tGovernor.bInFrame && s_tGovernor.lFramePeriod > 0) {
+        int64_t lNow = arm_2d_helper_get_system_timestamp();
+
+        if (0 == s_tGovernor.lNextFrame) {
+            s_tGovernor.lNextFrame = lNow;
+        }
+
+        int64_t lRemain = s_tGovernor.lNextFrame - lNow;
+        if (lRemain > 0) {
+            /* wait for the next frame slot */
+            __disp_adapter0_governor_request_wakeup(
+                (uint32_t)__disp_adapter0_ticks_to_us((int32_t)lRemain));
+            __WFE();
+            return arm_fsm_rt_on_going;
+        }
+
+        /* update jitter statistics */
+        int32_t nJitter = (int32_t)(-lRemain);
+        s_tGovernor.Jitter.nMin = MIN(nJitter, s_tGovernor.Jitter.nMin);
+        s_tGovernor.Jitter.nMax = MAX(nJitter, s_tGovernor.Jitter.nMax);
+        s_tGovernor.Jitter.lTotal += nJitter;
+        s_tGovernor.Jitter.hwCount++;
+
+        s_tGovernor.lNextFrame += s_tGovernor.lFramePeriod;
+        if (s_tGovernor.lNextFrame <= lNow) {
+            /* we are too late, resync to avoid bursts of frames */
+            s_tGovernor.lNextFrame = lNow + s_tGovernor.lFramePeriod;
+        }
+    }
+
+    s_tGovernor.bInFrame = true;
+#if __DISP0_CFG_VIRTUAL_TIMEBASE__
+    __disp_adapter0_timebase_on_task();
+#endif
+    tResult = arm_2d_scene_player_task(&DISP0_ADAPTER);
+
+    if (arm_fsm_rt_cpl == tResult) {
+        s_tGovernor.bInFrame = false;
+    } else if (arm_fsm_rt_wait_for_obj == tResult) {
+        /* wait for the flush-complete event */
+        __WFE();
+    }
+
+    return tResult;
+}
+#else
+arm_fsm_rt_t __disp_adapter0_task(void)
+{
+#if __DISP0_CFG_VIRTUAL_TIMEBASE__
+    __disp_adapter0_timebase_on_task();
+#endif
     return arm_2d_scene_player_task(&DISP0_ADAPTER);
 }
+#endif
+
+
+/*----------------------------------------------------------------------------*
+ * Static Layer Cache                                                         *
+ *----------------------------------------------------------------------------*/
+
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+
+static uint32_t __disp_adapter0_layer_cache_get_size(
+                                    const disp_adapter0_layer_cache_t *ptThis)
+{
+    uint32_t wSize = (uint32_t)ptThis->tCFG.tRegion.tSize.iWidth
+                   * (uint32_t)ptThis->tCFG.tRegion.tSize.iHeight
+                   * sizeof(COLOUR_INT);
+
+    /* keep every buffer 8 bytes aligned */
+    return (wSize + 7) & ~(uint32_t)7;
+}
+
+/* take the first gap in the pool which is big enough for the layer */
+static uint8_t *__disp_adapter0_layer_cache_pool_alloc(
+                                    disp_adapter0_layer_cache_t *ptThis)
+{
+    uint32_t wSize = __disp_adapter0_layer_cache_get_size(ptThis);
+    uintptr_t pnStart = (uintptr_t)s_tLayerCachePool.dwBuffer;
+    uintptr_t pnLimit = pnStart + sizeof(s_tLayerCachePool.dwBuffer);
+    disp_adapter0_layer_cache_t **pptPrevious = &s_ptLayerCacheList;
+
+    do {
+        disp_adapter0_layer_cache_t *ptNext = *pptPrevious;
+        uintptr_t pnEnd = (NULL == ptNext) 
+                        ? pnLimit 
+                        : (uintptr_t)ptNext->tLayer.pchBuffer;
+
+        if (pnEnd - pnStart >= wSize) {
+            ptThis->ptNext = ptNext;
+            *pptPrevious = ptThis;
+
+            return (uint8_t *)pnStart;
+        }
+
+        if (NULL == ptNext) {
+            break;
+        }
+
+        pnStart = (uintptr_t)ptNext->tLayer.pchBuffer
+                + __disp_adapter0_layer_cache_get_size(ptNext);
+        pptPrevious = &ptNext->ptNext;
+    } while(true);
+
+    return NULL;
+}
+
+static void __disp_adapter0_layer_cache_pool_free(
+                                    disp_adapter0_layer_cache_t *ptThis)
+{
+    disp_adapter0_layer_cache_t **pptPrevious = &s_ptLayerCacheList;
+
+    while (NULL != *pptPrevious) {
+        if (*pptPrevious == ptThis) {
+            *pptPrevious = ptThis->ptNext;
+            break;
+        }
+        pptPrevious = &(*pptPrevious)->ptNext;
+    }
+
+    ptThis->ptNext = NULL;
+    ptThis->tLayer.pchBuffer = NULL;
+}
+
+ARM_NONNULL(1,2)
+arm_2d_err_t disp_adapter0_layer_cache_init(
+                                disp_adapter0_layer_cache_t *ptThis,
+                                disp_adapter0_layer_cache_cfg_t *ptCFG)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptCFG);
+    assert(NULL != ptCFG->fnDrawLayer);
+
+    memset(ptThis, 0, sizeof(disp_adapter0_layer_cache_t));
+    ptThis->tCFG = *ptCFG;
+
+    if (0 == ptThis->tCFG.chOpacity) {
+        ptThis->tCFG.chOpacity = 255;
+    }
+
+    uint32_t wSize = __disp_adapter0_layer_cache_get_size(ptThis);
+    if (0 == wSize) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    if (wSize > sizeof(s_tLayerCachePool.dwBuffer)) {
+        return ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    ptThis->tLayer = (arm_2d_tile_t) {
+        .tRegion = {
+            .tSize = ptCFG->tRegion.tSize,
+        },
+        .tInfo = {
+            .bIsRoot = true,
+            .bHasEnforcedColour = true,
+            .tColourInfo = {
+                .chScheme = __DISP0_COLOUR_FORMAT__,
+            },
+        },
+        .pchBuffer = NULL,
+    };
+
+    ptThis->bValid = false;
+
+    return ARM_2D_ERR_NONE;
+}
+
+ARM_NONNULL(1)
+void disp_adapter0_layer_cache_invalidate(disp_adapter0_layer_cache_t *ptThis)
+{
+    assert(NULL != ptThis);
+
+    /* the layer is redrawn on the next new frame to avoid tearing */
+    ptThis->bValid = false;
+}
+
+ARM_NONNULL(1,2)
+bool disp_adapter0_layer_cache_show(disp_adapter0_layer_cache_t *ptThis,
+                                    const arm_2d_tile_t *ptTile,
+                                    bool bIsNewFrame)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptTile);
+
+    if (bIsNewFrame && !ptThis->bValid) {
+        if (NULL == ptThis->tLayer.pchBuffer) {
+            /* the pool might be held by the previous scene, retry on the next frame */
+            ptThis->tLayer.pchBuffer = __disp_adapter0_layer_cache_pool_alloc(ptThis);
+        }
+
+        if (NULL != ptThis->tLayer.pchBuffer) {
+            /* render the static layer into the off-screen buffer */
+            arm_2d_fill_colour( &ptThis->tLayer,
+                                NULL,
+                                ptThis->tCFG.tBackground);
+            ARM_2D_OP_WAIT_ASYNC();
+
+            while(arm_fsm_rt_cpl != ptThis->tCFG.fnDrawLayer(ptThis->tCFG.pTarget,
+                                                            &ptThis->tLayer,
+                                                            true));
+            ARM_2D_OP_WAIT_ASYNC();
+
+            ptThis->bValid = true;
+        }
+    }
+
+    if (!ptThis->bValid) {
+        if (ptThis->tCFG.bColourKeying || ptThis->tCFG.chOpacity < 255) {
+            /* only the user knows how to draw a blended layer directly */
+            return false;
+        }
+
+        /*
+         * no buffer, or the layer is invalidated in the middle of a frame:
+         * the buffer content is not trustworthy, draw the layer directly
+         */
+        arm_2d_container(ptTile, __layer, &ptThis->tCFG.tRegion) {
+            while(arm_fsm_rt_cpl != ptThis->tCFG.fnDrawLayer(
+                                                        ptThis->tCFG.pTarget,
+                                                        &__layer,
+                                                        bIsNewFrame));
+        }
+        return true;
+    }
+
+    /* restore the layer into the current PFB */
+    if (ptThis->tCFG.bColourKeying) {
+        if (ptThis->tCFG.chOpacity < 255) {
+            arm_2d_tile_copy_with_colour_keying_and_opacity(
+                                            &ptThis->tLayer,
+                                            ptTile,
+                                            &ptThis->tCFG.tRegion,
+                                            ptThis->tCFG.chOpacity,
+                                            ptThis->tCFG.tBackground);
+        } else {
+            arm_2d_tile_copy_with_colour_keying_only(
+                                            &ptThis->tLayer,
+                                            ptTile,
+                                            &ptThis->tCFG.tRegion,
+                                            ptThis->tCFG.tBackground);
+        }
+    } else if (ptThis->tCFG.chOpacity < 255) {
+        arm_2d_tile_copy_with_opacity(  &ptThis->tLayer,
+                                        ptTile,
+                                        &ptThis->tCFG.tRegion,
+                                        ptThis->tCFG.chOpacity);
+    } else {
+        arm_2d_tile_copy_only(  &ptThis->tLayer,
+                                ptTile,
+                                &ptThis->tCFG.tRegion);
+    }
+    ARM_2D_OP_WAIT_ASYNC();
+
+    return true;
+}
+
+ARM_NONNULL(1)
+void disp_adapter0_layer_cache_depose(disp_adapter0_layer_cache_t *ptThis)
+{
+    assert(NULL != ptThis);
+
+    if (NULL != ptThis->tLayer.pchBuffer) {
+        __disp_adapter0_layer_cache_pool_free(ptThis);
+    }
+    ptThis->bValid = false;
+}
+
+#endif
 
 
 /*----------------------------------------------------------------------------*
@@ -1009,6 +2179,16 @@ void __disp_adapter0_vres_asset_2dcopy( uintptr_t pObj,
 
     /* calculate offset */
     pSrc += (ptRegion->tLocation.iY * iSourceStride + ptRegion->tLocation.iX) * iPixelSize;
+
+    if (iSourceWidth == iSourceStride && iTargetStride == iSourceStride) {
+        /* the rows are contiguous in both the source and the target */
+        __disp_adapter0_vres_read_memory( 
+                                        pObj, 
+                                        (void *)pDes, 
+                                        (uintptr_t)pSrc, 
+                                        iPixelSize * iSourceWidth * iSourceHeight);
+        return ;
+    }
     
     for (int_fast16_t y = 0; y < iSourceHeight; y++) {
         __disp_adapter0_vres_read_memory( 
@@ -1022,6 +2202,244 @@ void __disp_adapter0_vres_asset_2dcopy( uintptr_t pObj,
     }
 }
 
+#if __DISP0_VRES_USE_CACHE__
+static
+__disp_adapter0_vres_cache_item_t *__disp_adapter0_vres_cache_find(
+                                                uintptr_t pAsset,
+                                                const arm_2d_region_t *ptRegion)
+{
+    arm_foreach(__disp_adapter0_vres_cache_item_t, s_tVRESCache.tItems, ptItem) {
+        if (NULL == ptItem->pBuffer || ptItem->pAsset != pAsset) {
+            continue;
+        }
+        if (0 == memcmp(&ptItem->tRegion, ptRegion, sizeof(arm_2d_region_t))) {
+            return ptItem;
+        }
+    }
+
+    return NULL;
+}
+
+static 
+bool __disp_adapter0_vres_cache_evict_one(void)
+{
+    __disp_adapter0_vres_cache_item_t *ptLRU = NULL;
+
+    /* find the least recently used region which is not in use */
+    arm_foreach(__disp_adapter0_vres_cache_item_t, s_tVRESCache.tItems, ptItem) {
+        if (    NULL == ptItem->pBuffer 
+           ||   ptItem->hwReference > 0
+           ||   !ptItem->bReady) {
+            continue;
+        }
+        if (    (NULL == ptLRU) 
+           ||   ((int32_t)(ptItem->wLastUsed - ptLRU->wLastUsed) < 0)) {
+            ptLRU = ptItem;
+        }
+    }
+
+    if (NULL == ptLRU) {
+        return false;
+    }
+
+    __disp_adapter0_free(ptLRU->pBuffer);
+    s_tVRESCache.wUsedSize -= ptLRU->wSize;
+    ptLRU->pBuffer = NULL;
+
+    return true;
+}
+
+static 
+__disp_adapter0_vres_cache_item_t *__disp_adapter0_vres_cache_reserve(
+                                                                size_t tSize)
+{
+    if (tSize > __DISP0_CFG_VRES_CACHE_SIZE__) {
+        return NULL;
+    }
+
+    /* make room for the new region */
+    while (s_tVRESCache.wUsedSize + tSize > __DISP0_CFG_VRES_CACHE_SIZE__) {
+        if (!__disp_adapter0_vres_cache_evict_one()) {
+            return NULL;
+        }
+    }
+
+    do {
+        arm_foreach(__disp_adapter0_vres_cache_item_t, s_tVRESCache.tItems, ptItem) {
+            if (NULL == ptItem->pBuffer) {
+                return ptItem;
+            }
+        }
+    } while(__disp_adapter0_vres_cache_evict_one());
+
+    return NULL;
+}
+
+static
+bool __disp_adapter0_vres_cache_release(void *pBuffer)
+{
+    arm_foreach(__disp_adapter0_vres_cache_item_t, s_tVRESCache.tItems, ptItem) {
+        if (ptItem->pBuffer == pBuffer) {
+            assert(ptItem->hwReference > 0);
+            ptItem->hwReference--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void disp_adapter0_vres_cache_flush(void)
+{
+    while(__disp_adapter0_vres_cache_evict_one());
+}
+#endif
+
+#if __DISP0_VRES_USE_PREFETCH__
+__WEAK
+arm_2d_err_t __disp_adapter0_vres_request_async_copy(   uintptr_t pObj,
+                                                        uintptr_t pSrc,
+                                                        uint32_t wSourceStride,
+                                                        uintptr_t pDes,
+                                                        uint32_t wTargetStride,
+                                                        uint32_t wBytesPerLine,
+                                                        int16_t iHeight)
+{
+    ARM_2D_UNUSED(pObj);
+    ARM_2D_UNUSED(pSrc);
+    ARM_2D_UNUSED(wSourceStride);
+    ARM_2D_UNUSED(pDes);
+    ARM_2D_UNUSED(wTargetStride);
+    ARM_2D_UNUSED(wBytesPerLine);
+    ARM_2D_UNUSED(iHeight);
+
+    return ARM_2D_ERR_NOT_SUPPORT;
+}
+
+void disp_adapter0_vres_insert_prefetch_complete_event_handler(void)
+{
+    __disp_adapter0_vres_cache_item_t *ptItem = s_tVRESPrefetch.ptPending;
+    if (NULL != ptItem) {
+        ptItem->bReady = true;
+        s_tVRESPrefetch.ptPending = NULL;
+    }
+}
+
+disp_adapter0_vres_statistics_t disp_adapter0_vres_get_statistics(void)
+{
+    return s_tVRESPrefetch.tStatistics;
+}
+
+static void __disp_adapter0_vres_prefetch_on_frame_complete(void)
+{
+    /* the log of the current frame becomes the prediction of the next one */
+    s_tVRESPrefetch.chCurrent ^= 1;
+    s_tVRESPrefetch.hwCount[s_tVRESPrefetch.chCurrent] = 0;
+    s_tVRESPrefetch.hwCursor = 0;
+}
+
+static void __disp_adapter0_vres_prefetch(
+                                const __disp_adapter0_vres_access_t *ptAccess)
+{
+    __disp_adapter0_vres_access_t *ptLog;
+    uint_fast8_t chCurrent = s_tVRESPrefetch.chCurrent;
+
+    /* log the access */
+    if (s_tVRESPrefetch.hwCount[chCurrent] < __DISP0_CFG_VRES_PREFETCH_LOG_SIZE__) {
+        ptLog = &s_tVRESPrefetch.tLog[chCurrent][s_tVRESPrefetch.hwCount[chCurrent]++];
+        *ptLog = *ptAccess;
+    }
+
+    if (s_tVRESPrefetch.bUnsupported || NULL != s_tVRESPrefetch.ptPending) {
+        return ;
+    }
+
+    /* find the same access in the previous frame */
+    uint_fast8_t chPrevious = chCurrent ^ 1;
+    uint_fast16_t hwCount = s_tVRESPrefetch.hwCount[chPrevious];
+    uint_fast16_t hwIndex = s_tVRESPrefetch.hwCursor;
+    bool bFound = false;
+
+    for (uint_fast16_t n = 0; n < hwCount; n++, hwIndex++) {
+        if (hwIndex >= hwCount) {
+            hwIndex = 0;
+        }
+        ptLog = &s_tVRESPrefetch.tLog[chPrevious][hwIndex];
+        if (    ptLog->pAsset == ptAccess->pAsset
+           &&   0 == memcmp(&ptLog->tRegion, 
+                            &ptAccess->tRegion, 
+                            sizeof(arm_2d_region_t))) {
+            bFound = true;
+            break;
+        }
+    }
+
+    if (!bFound || (hwIndex + 1) >= hwCount) {
+        return ;
+    }
+
+    /* the access following the current one is the prediction */
+    s_tVRESPrefetch.hwCursor = hwIndex + 1;
+    ptLog = &s_tVRESPrefetch.tLog[chPrevious][hwIndex + 1];
+
+    if (NULL != __disp_adapter0_vres_cache_find(ptLog->pAsset, &ptLog->tRegion)) {
+        return ;
+    }
+
+    size_t tBufferSize = ptLog->wBytesPerLine * ptLog->tRegion.tSize.iHeight;
+    __disp_adapter0_vres_cache_item_t *ptItem 
+        = __disp_adapter0_vres_cache_reserve(tBufferSize);
+    if (NULL == ptItem) {
+        return ;
+    }
+
+    void *pBuffer = __disp_adapter0_aligned_malloc(tBufferSize, ptLog->hwPixelSize);
+    if (NULL == pBuffer) {
+        return ;
+    }
+
+    ptItem->pAsset = ptLog->pAsset;
+    ptItem->tRegion = ptLog->tRegion;
+    ptItem->pBuffer = pBuffer;
+    ptItem->wSize = tBufferSize;
+    ptItem->wLastUsed = ++s_tVRESCache.wTick;
+    ptItem->hwReference = 0;
+    ptItem->bReady = false;
+    ptItem->bPrefetched = true;
+    s_tVRESCache.wUsedSize += tBufferSize;
+
+    s_tVRESPrefetch.ptPending = ptItem;
+
+    uintptr_t pSrc = ptLog->pAsset
+                   + ptLog->tRegion.tLocation.iY * ptLog->wSourceStride
+                   + ptLog->tRegion.tLocation.iX * ptLog->hwPixelSize;
+
+    arm_2d_err_t tResult
+        = __disp_adapter0_vres_request_async_copy(  ptLog->pObj,
+                                                    pSrc,
+                                                    ptLog->wSourceStride,
+                                                    (uintptr_t)pBuffer,
+                                                    ptLog->wBytesPerLine,
+                                                    ptLog->wBytesPerLine,
+                                                    ptLog->tRegion.tSize.iHeight);
+    if (ARM_2D_ERR_NONE != tResult) {
+        if (ARM_2D_ERR_NOT_SUPPORT == tResult) {
+            /* no asynchronous copy, stop prefetching */
+            s_tVRESPrefetch.bUnsupported = true;
+        }
+        /* otherwise, e.g. busy, try again with the next PFB */
+        s_tVRESPrefetch.ptPending = NULL;
+        ptItem->bReady = true;
+        __disp_adapter0_free(pBuffer);
+        s_tVRESCache.wUsedSize -= tBufferSize;
+        ptItem->pBuffer = NULL;
+        return ;
+    }
+
+    s_tVRESPrefetch.tStatistics.wPrefetch++;
+}
+#endif
+
 intptr_t __disp_adapter0_vres_asset_loader (uintptr_t pObj, 
                                             arm_2d_vres_t *ptVRES, 
                                             arm_2d_region_t *ptRegion)
@@ -1076,6 +2494,56 @@ intptr_t __disp_adapter0_vres_asset_loader (uintptr_t pObj,
     tBufferSize = ptRegion->tSize.iHeight * nBytesPerLine;
     
     
+#if __DISP0_VRES_USE_CACHE__
+    uintptr_t pAsset = __disp_adapter0_vres_get_asset_address(pObj, ptVRES);
+    __disp_adapter0_vres_cache_item_t *ptItem 
+        = __disp_adapter0_vres_cache_find(pAsset, ptRegion);
+
+#   if __DISP0_VRES_USE_PREFETCH__
+    __disp_adapter0_vres_access_t tAccess = {
+        .pObj = pObj,
+        .pAsset = pAsset,
+        .tRegion = *ptRegion,
+        .wSourceStride = ptVRES->tTile.tRegion.tSize.iWidth * nPixelSize,
+        .wBytesPerLine = nBytesPerLine,
+        .hwPixelSize = nPixelSize,
+    };
+#   endif
+
+    if (NULL != ptItem) {
+        /* cache hit */
+    #if __DISP0_VRES_USE_PREFETCH__
+        s_tVRESPrefetch.tStatistics.wHit++;
+        if (ptItem->bPrefetched) {
+            ptItem->bPrefetched = false;
+            s_tVRESPrefetch.tStatistics.wPrefetchHit++;
+        }
+        if (!ptItem->bReady) {
+            s_tVRESPrefetch.tStatistics.wPrefetchLate++;
+            while(!ptItem->bReady) {
+                __WFE();
+            }
+        }
+    #endif
+        ptItem->hwReference++;
+        ptItem->wLastUsed = ++s_tVRESCache.wTick;
+
+    #if __DISP0_VRES_USE_PREFETCH__
+        if (nBitsPerPixel >= 8) {
+            __disp_adapter0_vres_prefetch(&tAccess);
+        }
+    #endif
+        return (intptr_t)ptItem->pBuffer;
+    }
+
+#   if __DISP0_VRES_USE_PREFETCH__
+    s_tVRESPrefetch.tStatistics.wMiss++;
+#   endif
+
+    /* NULL means the region will not be cached */
+    ptItem = __disp_adapter0_vres_cache_reserve(tBufferSize);
+#endif
+
 #if __DISP0_CFG_USE_HEAP_FOR_VIRTUAL_RESOURCE_HELPER__
     pBuffer = __disp_adapter0_aligned_malloc(tBufferSize, nPixelSize);
     assert(NULL != pBuffer);
@@ -1086,6 +2554,7 @@ intptr_t __disp_adapter0_vres_asset_loader (uintptr_t pObj,
 #else
     arm_2d_pfb_t *ptPFB = __arm_2d_helper_pfb_new(&DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t);
     assert(NULL != ptPFB);
+    __DISP0_PFB_POOL_TAKE();
     
     assert(ptPFB->u24Size >= tBufferSize);
     
@@ -1106,15 +2575,23 @@ intptr_t __disp_adapter0_vres_asset_loader (uintptr_t pObj,
         /* calculate offset */
         pSrc += (ptRegion->tLocation.iY * iSourceStride);
         pSrc += (ptRegion->tLocation.iX * nBitsPerPixel) >> 3;
-        
-        for (int_fast16_t y = 0; y < ptRegion->tSize.iHeight; y++) {
+
+        if (nBytesPerLine == (uint32_t)iSourceStride) {
+            /* the rows are contiguous, read them in one go */
             __disp_adapter0_vres_read_memory(   pObj, 
                                                 (void *)pDes, 
                                                 (uintptr_t)pSrc, 
-                                                nBytesPerLine);
-
-            pDes += nBytesPerLine;
-            pSrc += iSourceStride;
+                                                nBytesPerLine * ptRegion->tSize.iHeight);
+        } else {
+            for (int_fast16_t y = 0; y < ptRegion->tSize.iHeight; y++) {
+                __disp_adapter0_vres_read_memory(   pObj, 
+                                                    (void *)pDes, 
+                                                    (uintptr_t)pSrc, 
+                                                    nBytesPerLine);
+
+                pDes += nBytesPerLine;
+                pSrc += iSourceStride;
+            }
         }
     } else {
         uintptr_t pSrc = __disp_adapter0_vres_get_asset_address(pObj, ptVRES);
@@ -1131,6 +2608,27 @@ intptr_t __disp_adapter0_vres_asset_loader (uintptr_t pObj,
                                             iSourceStride, 
                                             nPixelSize);
     } while(0);
+
+#if __DISP0_VRES_USE_CACHE__
+    if (NULL != ptItem) {
+        ptItem->pAsset = pAsset;
+        ptItem->tRegion = *ptRegion;
+        ptItem->pBuffer = pBuffer;
+        ptItem->wSize = tBufferSize;
+        ptItem->wLastUsed = ++s_tVRESCache.wTick;
+        ptItem->hwReference = 1;
+        ptItem->bReady = true;
+        ptItem->bPrefetched = false;
+
+        s_tVRESCache.wUsedSize += tBufferSize;
+    }
+#endif
+
+#if __DISP0_VRES_USE_PREFETCH__
+    if (nBitsPerPixel >= 8) {
+        __disp_adapter0_vres_prefetch(&tAccess);
+    }
+#endif
     
     return (intptr_t)pBuffer;
 }
@@ -1146,6 +2644,12 @@ void __disp_adapter0_vres_buffer_deposer (
     ARM_2D_UNUSED(ptVRES);
 
     if ((intptr_t)NULL != pBuffer) {
+    #if __DISP0_VRES_USE_CACHE__
+        if (__disp_adapter0_vres_cache_release((void *)pBuffer)) {
+            /* keep the region in the cache */
+            return ;
+        }
+    #endif
         __disp_adapter0_free((void *)pBuffer);
     }
 #else
@@ -1157,6 +2661,7 @@ void __disp_adapter0_vres_buffer_deposer (
     
     arm_2d_pfb_t *ptPFB = (arm_2d_pfb_t *)((uintptr_t)pBuffer - sizeof(arm_2d_pfb_t));
     __arm_2d_helper_pfb_free(&DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t, ptPFB);
+    __DISP0_PFB_POOL_GIVE();
 #endif
 }
 
@@ -154,6 +154,14 @@ extern "C" {
 #   define __DISP0_CFG_NAVIGATION_LAYER_MODE__                     0
 #endif
 
+// <q> Cache the Navigation Layer Text
+// <i> Render the text of the navigation layer into a small off-screen tile only when the numbers change, and blit the tile (with colour-keying) into each PFB instead of formatting and rasterising the glyphs again.
+// <i> NOTE: This feature consumes (screen width * 8) pixels in normal mode or (100 * 24) pixels in tiny mode.
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_NAVIGATION_LAYER_CACHE__
+#   define __DISP0_CFG_NAVIGATION_LAYER_CACHE__                    0
+#endif
+
 // <o>Number of iterations <0-2000>
 // <i> run number of iterations before calculate the FPS.
 #ifndef __DISP0_CFG_ITERATION_CNT__
@@ -168,6 +176,55 @@ extern "C" {
 #   define __DISP0_CFG_FPS_CACULATION_MODE__                       1
 #endif
 
+// <q> Enable Frame Statistics Histograms
+// <i> Record the frame time, the render latency and the flush latency of each frame in histograms, report p50/p95/p99 with the FPS log and count skipped frames separately.
+// <i> Use disp_adapter0_dump_frame_statistics() to dump the histograms in CSV format over stdio.
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+#   define __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__                    0
+#endif
+
+// <o>Number of histogram bins <4-256>
+// <i> The samples beyond the range of the histogram are counted separately as overflows.
+#ifndef __DISP0_CFG_HISTOGRAM_BINS__
+#   define __DISP0_CFG_HISTOGRAM_BINS__                            64
+#endif
+
+// <o>Width of each histogram bin (ms) <1-100>
+#ifndef __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__
+#   define __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__                    2
+#endif
+
+// <q> Enable Memory Statistics
+// <i> Track the peak number of PFBs held by the display adapter (in flushing or lent to the virtual resource helper) and log it together with the FPS.
+// <i> The platform can log more memory statistics (e.g. the scratch memory and stacks) in __disp_adapter0_user_log_statistics().
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+#   define __DISP0_CFG_ENABLE_MEMORY_STATISTICS__                  0
+#endif
+
+// <q> Enable the Frame Governor
+// <i> Limit the frame rate to a target FPS set by disp_adapter0_set_target_fps() and put the CPU into sleep with __WFE() between frames and when waiting for the flush-complete event.
+// <i> NOTE: The platform can implement __disp_adapter0_governor_request_wakeup() to wake the CPU up at the next frame slot.
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+#   define __DISP0_CFG_ENABLE_FRAME_GOVERNOR__                     0
+#endif
+
+// <q> Enable the Virtual Timebase
+// <i> Provide a virtual clock that advances a fixed step per frame. When it is switched on by disp_adapter0_set_virtual_timebase(), disp_adapter0_get_scene_timestamp() and the disp_adapter0_scene_xxxx() time helpers return the virtual time, so the scenes render the same frame sequence regardless of the rendering speed.
+// <i> NOTE: arm_2d_helper_get_system_timestamp() always returns the real time, so the PFB helper statistics, the FPS and the latency histograms stay real. Controls that read the Arm-2D timestamp by themselves still follow the real clock.
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_VIRTUAL_TIMEBASE__
+#   define __DISP0_CFG_VIRTUAL_TIMEBASE__                          0
+#endif
+
+// <o>Frame rate of the virtual timebase <1-1000>
+// <i> The virtual clock advances (1000 / this value) ms per frame.
+#ifndef __DISP0_CFG_VIRTUAL_TIMEBASE_FPS__
+#   define __DISP0_CFG_VIRTUAL_TIMEBASE_FPS__                      30
+#endif
+
 // <q> Enable Console
 // <i> Add a simple console to the display adapter in a floating window.
 // <i> This feature is disabled by default.
@@ -228,6 +285,14 @@ extern "C" {
 #   define __DISP0_CFG_ENABLE_3FB_HELPER_SERVICE__                 0
 #endif
 
+// <q>Enable the differential flushing mode with a shadow framebuffer
+// <i> Keep a copy of the screen in a shadow framebuffer, compare each PFB with it row by row and only flush the changed span of each row to the LCD.
+// <i> NOTE: The shadow framebuffer takes (screen width x screen height x colour size) bytes of RAM. It cannot be used with the 3FB helper service.
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__
+#   define __DISP0_CFG_USE_SHADOW_FRAMEBUFFER__                    0
+#endif
+
 // <q>Disable the default scene
 // <i> Remove the default scene for this display adapter. We highly recommend you to disable the default scene when creating real applications.
 #ifndef __DISP0_CFG_DISABLE_DEFAULT_SCENE__
@@ -254,6 +319,45 @@ extern "C" {
 #   define __DISP0_CFG_USE_HEAP_FOR_VIRTUAL_RESOURCE_HELPER__      0
 #endif
 
+// <o>The size of the virtual resource cache (in bytes) <0-262144>
+// <i> Keep recently loaded regions of virtual resources in a LRU cache, so the same region of an asset will not be loaded again in the following frames. Set 0 to disable the cache.
+// <i> NOTE: The cache requires the option "Use heap to allocate buffer in the virtual resource helper service".
+#ifndef __DISP0_CFG_VRES_CACHE_SIZE__
+#   define __DISP0_CFG_VRES_CACHE_SIZE__                            0
+#endif
+
+// <o>The maximum number of regions in the virtual resource cache <1-64>
+#ifndef __DISP0_CFG_VRES_CACHE_ITEM_COUNT__
+#   define __DISP0_CFG_VRES_CACHE_ITEM_COUNT__                      16
+#endif
+
+// <q>Prefetch virtual resources asynchronously
+// <i> Predict the regions the next PFB will need from the access log of the previous frame and load them into the virtual resource cache with __disp_adapter0_vres_request_async_copy() while the current PFB is rendering.
+// <i> NOTE: It requires the virtual resource cache. Only assets with 8 bits or more per pixel are prefetched.
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_VRES_PREFETCH__
+#   define __DISP0_CFG_VRES_PREFETCH__                              0
+#endif
+
+// <o>The size of the access log for the virtual resource prefetching <4-256>
+#ifndef __DISP0_CFG_VRES_PREFETCH_LOG_SIZE__
+#   define __DISP0_CFG_VRES_PREFETCH_LOG_SIZE__                     32
+#endif
+
+// <q>Enable the static layer cache service
+// <i> Render a static layer (e.g. a background) once into an off-screen buffer and restore it into each PFB with a tile copy.
+// <i> NOTE: The off-screen buffers are taken from a static pool, the size of a buffer is the size of the cached region.
+// <i> This feature is disabled by default.
+#ifndef __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+#   define __DISP0_CFG_USE_STATIC_LAYER_CACHE__                     0
+#endif
+
+// <o>The size (in bytes) of the static layer cache pool
+// <i> The pool is a statically allocated region shared by the layers of all scenes. The default value holds a 240*240 RGB565 layer, e.g. the dial of a watch face.
+#ifndef __DISP0_CFG_STATIC_LAYER_CACHE_POOL_SIZE__
+#   define __DISP0_CFG_STATIC_LAYER_CACHE_POOL_SIZE__               115200
+#endif
+
 // <o>The Anti-Noise-Scanning block Width
 // <i> The width of the anti-noise-scanning block size
 #ifndef __DISP0_CFG_PFB_ANS_WIDTH__
@@ -288,6 +392,29 @@ extern "C" {
 
 /*============================ MACROFIED FUNCTIONS ===========================*/
 
+#if !__DISP0_CFG_VIRTUAL_TIMEBASE__
+/* without the virtual timebase, the scene time is the real time */
+#   define disp_adapter0_get_scene_timestamp()                                  \
+            arm_2d_helper_get_system_timestamp()
+#   define disp_adapter0_scene_is_time_out(__MS, __TIMESTAMP_PTR)               \
+            arm_2d_helper_is_time_out((__MS), (__TIMESTAMP_PTR))
+#   define disp_adapter0_scene_time_liner_slider(                               \
+                        __FROM, __TO, __MS, __STRIDE_PTR, __TIMESTAMP_PTR)      \
+            arm_2d_helper_time_liner_slider(                                    \
+                        (__FROM), (__TO), (__MS),                               \
+                        (__STRIDE_PTR), (__TIMESTAMP_PTR))
+#   define disp_adapter0_scene_time_liner_slider_i64(                           \
+                        __FROM, __TO, __MS, __STRIDE_PTR, __TIMESTAMP_PTR)      \
+            arm_2d_helper_time_liner_slider_i64(                                \
+                        (__FROM), (__TO), (__MS),                               \
+                        (__STRIDE_PTR), (__TIMESTAMP_PTR))
+#   define disp_adapter0_scene_time_half_cos_slider(                            \
+                        __FROM, __TO, __MS, __STRIDE_PTR, __TIMESTAMP_PTR)      \
+            arm_2d_helper_time_half_cos_slider(                                 \
+                        (__FROM), (__TO), (__MS),                               \
+                        (__STRIDE_PTR), (__TIMESTAMP_PTR))
+#endif
+
 #if __DISP0_CFG_VIRTUAL_RESOURCE_HELPER__
 #define disp_adapter0_impl_vres(__COLOUR_FORMAT, __WIDTH, __HEIGHT,...)         \
 {                                                                               \
@@ -335,6 +462,76 @@ extern "C" {
         ARM_2D_SAFE_NAME(ret);})
 
 /*============================ TYPES =========================================*/
+
+#if     __DISP0_CFG_VIRTUAL_RESOURCE_HELPER__                                   \
+    &&  __DISP0_CFG_VRES_CACHE_SIZE__ > 0                                       \
+    &&  __DISP0_CFG_VRES_PREFETCH__
+/*!
+ * \brief the statistics of the virtual resource loader
+ */
+typedef struct disp_adapter0_vres_statistics_t {
+    uint32_t wHit;                      //!< the number of loads served by the cache
+    uint32_t wMiss;                     //!< the number of loads read synchronously
+    uint32_t wPrefetch;                 //!< the number of prefetches issued
+    uint32_t wPrefetchHit;              //!< the number of prefetched regions used
+    uint32_t wPrefetchLate;             //!< the number of loads waiting for a prefetch
+} disp_adapter0_vres_statistics_t;
+#endif
+
+#if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+/*!
+ * \brief the usage of the PFB pool seen by the display adapter
+ */
+typedef struct disp_adapter0_pfb_pool_statistics_t {
+    uint16_t hwPoolSize;                //!< the number of PFBs in the pool
+    uint16_t hwHeld;                    //!< PFBs held by the adapter now
+    uint16_t hwPeak;                    //!< the peak number of PFBs in use
+} disp_adapter0_pfb_pool_statistics_t;
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+/*!
+ * \brief the latency types recorded in the frame statistics histograms
+ */
+typedef enum {
+    DISP0_LATENCY_FRAME,                //!< the time between two frames
+    DISP0_LATENCY_RENDER,               //!< the time used to render a frame
+    DISP0_LATENCY_FLUSH,                //!< the time waiting for the flushing of a frame
+    __DISP0_LATENCY_TYPE_COUNT,
+} disp_adapter0_latency_t;
+
+/*!
+ * \brief the percentile is beyond the range of the histogram
+ */
+#define DISP0_LATENCY_OVERFLOW              UINT32_MAX
+#endif
+
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+/*!
+ * \brief the configuration of a static layer cache
+ */
+typedef struct disp_adapter0_layer_cache_cfg_t {
+    arm_2d_helper_draw_handler_t *fnDrawLayer;  //!< the routine to draw the static layer
+    void *pTarget;                              //!< the user object passed to fnDrawLayer
+    arm_2d_region_t tRegion;                    //!< the region of the layer on the screen
+    COLOUR_INT tBackground;                     //!< the colour used to clear the layer before drawing
+    bool bColourKeying;                         //!< tBackground is transparent when the layer is restored
+    uint8_t chOpacity;                          //!< the opacity used to restore the layer, 0 means 255
+} disp_adapter0_layer_cache_cfg_t;
+
+/*!
+ * \brief the static layer cache
+ */
+typedef struct disp_adapter0_layer_cache_t disp_adapter0_layer_cache_t;
+
+struct disp_adapter0_layer_cache_t {
+    disp_adapter0_layer_cache_cfg_t tCFG;
+    arm_2d_tile_t tLayer;
+    disp_adapter0_layer_cache_t *ptNext;        //!< the next layer holding a buffer in the pool
+    bool bValid;
+};
+#endif
+
 /*============================ GLOBAL VARIABLES ==============================*/
 ARM_NOINIT
 extern
@@ -348,6 +545,204 @@ void disp_adapter0_init(void);
 extern
 arm_fsm_rt_t __disp_adapter0_task(void);
 
+/*!
+ * \brief An user implemented function to log extra statistics, e.g. memory 
+ *        usage. It is called when the display adapter logs the FPS.
+ */
+extern
+void __disp_adapter0_user_log_statistics(void);
+
+#if __DISP0_CFG_ENABLE_MEMORY_STATISTICS__
+/*!
+ * \brief get the usage of the PFB pool
+ * \note  The PFB being rendered is counted as in use.
+ * \return disp_adapter0_pfb_pool_statistics_t the usage
+ */
+extern
+disp_adapter0_pfb_pool_statistics_t disp_adapter0_get_pfb_pool_statistics(void);
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_HISTOGRAM__
+/*!
+ * \brief get a percentile of the recorded latency
+ * \param[in] tType the latency type
+ * \param[in] chPercent the percentile, e.g. 50, 95, 99
+ * \return uint32_t the latency in ms (upper bound of the histogram bin), 
+ *         DISP0_LATENCY_OVERFLOW means the percentile is beyond the range of
+ *         the histogram, i.e. larger than 
+ *         __DISP0_CFG_HISTOGRAM_BINS__ * __DISP0_CFG_HISTOGRAM_BIN_WIDTH_MS__
+ */
+extern
+uint32_t disp_adapter0_get_latency_percentile(disp_adapter0_latency_t tType,
+                                              uint_fast8_t chPercent);
+
+/*!
+ * \brief get the number of samples beyond the range of the histogram
+ * \param[in] tType the latency type
+ */
+extern
+uint32_t disp_adapter0_get_latency_overflow_count(disp_adapter0_latency_t tType);
+
+/*!
+ * \brief get the number of skipped frames since the last reset
+ */
+extern
+uint32_t disp_adapter0_get_skipped_frame_count(void);
+
+/*!
+ * \brief dump the frame statistics histograms in CSV format over stdio
+ */
+extern
+void disp_adapter0_dump_frame_statistics(void);
+
+/*!
+ * \brief clear the frame statistics histograms, e.g. on a scene switch, so
+ *        the percentiles describe the current scene only
+ */
+extern
+void disp_adapter0_reset_frame_statistics(void);
+#endif
+
+#if __DISP0_CFG_ENABLE_FRAME_GOVERNOR__
+/*!
+ * \brief set the target frame rate of the frame governor
+ * \param[in] hwFPS the target FPS, 0 means no limitation
+ */
+extern
+void disp_adapter0_set_target_fps(uint_fast16_t hwFPS);
+
+/*!
+ * \brief get the target frame rate of the frame governor
+ * \return uint_fast16_t the target FPS, 0 means no limitation
+ */
+extern
+uint_fast16_t disp_adapter0_get_target_fps(void);
+
+/*!
+ * \brief An user implemented interface to wake up the CPU after a given time.
+ * \note The frame governor calls this function before going to sleep with 
+ *       __WFE(). If it is not implemented, the CPU is woken up by any other 
+ *       interrupts or events.
+ * \param[in] wUS the number of microseconds to the next frame slot
+ */
+extern
+void __disp_adapter0_governor_request_wakeup(uint32_t wUS);
+#endif
+
+#if __DISP0_CFG_VIRTUAL_TIMEBASE__
+/*!
+ * \brief switch the virtual timebase on or off
+ * \note The virtual clock and the frame number restart from the same origin
+ *       every time the timebase is switched on. Please switch it on before 
+ *       loading a scene (e.g. in the before-switching event handler), so all 
+ *       timestamps of the scene are taken from the virtual clock.
+ * \param[in] bEnable whether disp_adapter0_get_scene_timestamp() returns 
+ *            the virtual time
+ */
+extern
+void disp_adapter0_set_virtual_timebase(bool bEnable);
+
+/*!
+ * \brief check whether the virtual timebase is in use
+ * \retval true disp_adapter0_get_scene_timestamp() returns the virtual time
+ * \retval false disp_adapter0_get_scene_timestamp() returns the real time
+ */
+extern
+bool disp_adapter0_is_virtual_timebase_enabled(void);
+
+/*!
+ * \brief get the number of frames completed since the virtual timebase was 
+ *        switched on
+ * \return uint32_t the frame number
+ */
+extern
+uint32_t disp_adapter0_get_frame_number(void);
+
+/*!
+ * \brief get the real cost of the last frame, from the first call of 
+ *        disp_adapter0_task() in the frame to the frame-complete event
+ * \return int32_t the number of ticks of the real clock
+ */
+extern
+int32_t disp_adapter0_get_frame_cycles(void);
+
+/*!
+ * \brief get the timestamp of the scenes
+ * \note Scenes should take their timestamps here rather than from 
+ *       arm_2d_helper_get_system_timestamp(), which always returns the real 
+ *       time.
+ * \return int64_t the virtual time when the virtual timebase is switched on,
+ *         otherwise the real time, in ticks
+ */
+extern
+int64_t disp_adapter0_get_scene_timestamp(void);
+
+/*!
+ * \brief arm_2d_helper_is_time_out() on the scene timestamp
+ * \param[in] wPeriodMS the period in ms
+ * \param[in,out] plTimestamp the deadline, 0 starts a new period
+ * \retval true the period is over and a new one has started
+ * \retval false the period is not over yet
+ */
+extern
+ARM_NONNULL(2)
+bool disp_adapter0_scene_is_time_out(uint32_t wPeriodMS, int64_t *plTimestamp);
+
+/*!
+ * \brief arm_2d_helper_time_liner_slider() on the scene timestamp
+ * \param[in] nFrom the start value
+ * \param[in] nTo the end value
+ * \param[in] wPeriodMS the time to move from nFrom to nTo in ms
+ * \param[out] pnStride the current value
+ * \param[in,out] plTimestamp the start time, 0 starts the slider
+ * \retval true the slider has reached nTo
+ * \retval false the slider is still moving
+ */
+extern
+ARM_NONNULL(4, 5)
+bool disp_adapter0_scene_time_liner_slider( int32_t nFrom,
+                                            int32_t nTo,
+                                            uint32_t wPeriodMS,
+                                            int32_t *pnStride,
+                                            int64_t *plTimestamp);
+
+/*!
+ * \brief arm_2d_helper_time_liner_slider_i64() on the scene timestamp
+ * \param[in] lFrom the start value
+ * \param[in] lTo the end value
+ * \param[in] wPeriodMS the time to move from lFrom to lTo in ms
+ * \param[out] plStride the current value
+ * \param[in,out] plTimestamp the start time, 0 starts the slider
+ * \retval true the slider has reached lTo
+ * \retval false the slider is still moving
+ */
+extern
+ARM_NONNULL(4, 5)
+bool disp_adapter0_scene_time_liner_slider_i64( int64_t lFrom,
+                                                int64_t lTo,
+                                                uint32_t wPeriodMS,
+                                                int64_t *plStride,
+                                                int64_t *plTimestamp);
+
+/*!
+ * \brief arm_2d_helper_time_half_cos_slider() on the scene timestamp
+ * \param[in] nFrom the start value
+ * \param[in] nTo the end value
+ * \param[in] wPeriodMS the time to move from nFrom to nTo in ms
+ * \param[out] pnStride the current value
+ * \param[in,out] plTimestamp the start time, 0 starts the slider
+ * \retval true the slider has reached nTo
+ * \retval false the slider is still moving
+ */
+extern
+ARM_NONNULL(4, 5)
+bool disp_adapter0_scene_time_half_cos_slider(  int32_t nFrom,
+                                                int32_t nTo,
+                                                uint32_t wPeriodMS,
+                                                int32_t *pnStride,
+                                                int64_t *plTimestamp);
+#endif
+
 
 #if __DISP0_CFG_VIRTUAL_RESOURCE_HELPER__
 /*!
@@ -413,6 +808,84 @@ void __disp_adapter0_vres_read_memory( intptr_t pObj,
                                                 uintptr_t pAddress,
                                                 size_t nSizeInByte);
 
+/*!
+ * \brief A user overridable function to copy a region of an asset stored in 
+ *        external memory to a local buffer. The default implementation 
+ *        merges contiguous rows into one __disp_adapter0_vres_read_memory() 
+ *        call. You can override it to use a 2D DMA when the source permits.
+ *
+ * \param[in] pObj an pointer of user defined object, it is used for OOC
+ * \param[in] ptVRES the target virtual resource object
+ * \param[in] ptRegion the target region inside the asset
+ * \param[in] pSrc the address of the asset in the external memory
+ * \param[in] pDes the address of the local buffer
+ * \param[in] iTargetStride the stride of the local buffer (in pixels)
+ * \param[in] iSourceStride the stride of the asset (in pixels)
+ * \param[in] iPixelSize the size of a pixel (in bytes)
+ */
+extern
+void __disp_adapter0_vres_asset_2dcopy( uintptr_t pObj,
+                                        arm_2d_vres_t *ptVRES,
+                                        arm_2d_region_t *ptRegion,
+                                        uintptr_t pSrc,
+                                        uintptr_t pDes,
+                                        int16_t iTargetStride,
+                                        int16_t iSourceStride,
+                                        int16_t iPixelSize);
+
+#   if __DISP0_CFG_VRES_CACHE_SIZE__ > 0
+/*!
+ * \brief drop all unused regions in the virtual resource cache, e.g. when the
+ *        content of the assets in the external memory is changed.
+ */
+extern
+void disp_adapter0_vres_cache_flush(void);
+
+#       if __DISP0_CFG_VRES_PREFETCH__
+/*!
+ * \brief An user implemented interface to start an asynchronous copy from the 
+ *        external memory to a local buffer, e.g. with a spare DMA channel. 
+ *        When the copy is complete, you have to call 
+ *        disp_adapter0_vres_insert_prefetch_complete_event_handler().
+ *
+ * \param[in] pObj an pointer of user defined object, it is used for OOC
+ * \param[in] pSrc the address of the first row in the external memory
+ * \param[in] wSourceStride the stride of the source (in bytes)
+ * \param[in] pDes the address of the local buffer
+ * \param[in] wTargetStride the stride of the local buffer (in bytes)
+ * \param[in] wBytesPerLine the number of bytes to copy in each row
+ * \param[in] iHeight the number of rows
+ * \retval ARM_2D_ERR_NONE the copy is started
+ * \retval ARM_2D_ERR_BUSY the previous copy is still in progress, try later
+ * \retval ARM_2D_ERR_NOT_SUPPORT there is no asynchronous copy, the adapter
+ *         stops prefetching
+ * \retval ARM_2D_ERR_INVALID_PARAM nothing to copy
+ */
+extern
+arm_2d_err_t __disp_adapter0_vres_request_async_copy(   uintptr_t pObj,
+                                                        uintptr_t pSrc,
+                                                        uint32_t wSourceStride,
+                                                        uintptr_t pDes,
+                                                        uint32_t wTargetStride,
+                                                        uint32_t wBytesPerLine,
+                                                        int16_t iHeight);
+
+/*!
+ * \brief the handler for the prefetch complete event.
+ * \note It is usually called in the DMA transfer complete ISR.
+ */
+extern
+void disp_adapter0_vres_insert_prefetch_complete_event_handler(void);
+
+/*!
+ * \brief get the statistics of the virtual resource loader
+ * \return the statistics
+ */
+extern
+disp_adapter0_vres_statistics_t disp_adapter0_vres_get_statistics(void);
+#       endif
+#   endif
+
 #endif
 
 #if __DISP0_CFG_ENABLE_ASYNC_FLUSHING__
@@ -545,6 +1018,60 @@ void *disp_adapter0_3fb_get_flush_pointer(void);
 #endif
 
 
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+/*!
+ * \brief initialize a static layer cache
+ * \note the off-screen buffer is taken from the pool when the layer is shown
+ *       for the first time, so a preloaded scene does not hold the pool
+ *       before it is switched in.
+ * \param[in] ptThis the target layer cache
+ * \param[in] ptCFG the configuration
+ * \retval ARM_2D_ERR_NONE the layer cache is ready
+ * \retval ARM_2D_ERR_INVALID_PARAM the region is empty
+ * \retval ARM_2D_ERR_INSUFFICIENT_RESOURCE the layer never fits in the pool
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t disp_adapter0_layer_cache_init(
+                                disp_adapter0_layer_cache_t *ptThis,
+                                disp_adapter0_layer_cache_cfg_t *ptCFG);
+
+/*!
+ * \brief request to redraw the static layer at the beginning of next frame
+ * \param[in] ptThis the target layer cache
+ */
+extern
+ARM_NONNULL(1)
+void disp_adapter0_layer_cache_invalidate(disp_adapter0_layer_cache_t *ptThis);
+
+/*!
+ * \brief restore the static layer into the target PFB. The layer is
+ *        redrawn into the off-screen buffer on a new frame if it is invalid.
+ *        An invalid opaque layer is never copied, it is drawn directly 
+ *        instead.
+ * \note please call this function before drawing the dynamic layers
+ * \param[in] ptThis the target layer cache
+ * \param[in] ptTile the target tile (PFB)
+ * \param[in] bIsNewFrame whether this is the first PFB of a new frame
+ * \retval true the layer is shown
+ * \retval false the layer is blended (i.e. colour keyed or translucent) and 
+ *        not cached yet, the caller should draw it directly
+ */
+extern
+ARM_NONNULL(1,2)
+bool disp_adapter0_layer_cache_show(disp_adapter0_layer_cache_t *ptThis,
+                                    const arm_2d_tile_t *ptTile,
+                                    bool bIsNewFrame);
+
+/*!
+ * \brief return the off-screen buffer of a static layer cache to the pool
+ * \param[in] ptThis the target layer cache
+ */
+extern
+ARM_NONNULL(1)
+void disp_adapter0_layer_cache_depose(disp_adapter0_layer_cache_t *ptThis);
+#endif
+
 #if __DISP0_CFG_USE_CONSOLE__
 extern
 ARM_NONNULL(1)
@@ -20,6 +20,7 @@
 
 #define __USER_SCENE_COMPASS_IMPLEMENT__
 #include "arm_2d_scene_compass.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #if defined(RTE_Acceleration_Arm_2D_Helper_PFB)
 
@@ -116,6 +117,8 @@ enum {
 /*============================ PROTOTYPES ====================================*/
 /*============================ LOCAL VARIABLES ===============================*/
 
+static const char c_chCompassTitle[] = "Scene compass";
+
 /*! define dirty regions */
 IMPL_ARM_2D_REGION_LIST(s_tDirtyRegions, static)
 
@@ -187,6 +190,10 @@ static void __on_scene_compass_depose(arm_2d_scene_t *ptScene)
     ARM_2D_UNUSED(ptThis);
     
     meter_pointer_depose(&this.tCompass);
+
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    disp_adapter0_layer_cache_depose(&this.tTitleLayer);
+#endif
     
     arm_foreach(int64_t,this.lTimestamp, ptItem) {
         *ptItem = 0;
@@ -224,10 +231,10 @@ static void __on_scene_compass_frame_start(arm_2d_scene_t *ptScene)
 
     do {
         /* generate a new position every 2000 sec */
-        if (arm_2d_helper_is_time_out(3000,  &this.lTimestamp[1])) {
+        if (disp_adapter0_scene_is_time_out(3000,  &this.lTimestamp[1])) {
             this.lTimestamp[1] = 0;
 
-            srand(arm_2d_helper_get_system_timestamp());
+            srand(disp_adapter0_get_scene_timestamp());
 
             this.iTargetAngle = rand() % 3600;
         } 
@@ -261,7 +268,7 @@ static void __on_scene_compass_frame_complete(arm_2d_scene_t *ptScene)
 
 #if 0
     /* switch to next scene after 20s */
-    if (arm_2d_helper_is_time_out(20000, &this.lTimestamp[0])) {
+    if (disp_adapter0_scene_is_time_out(20000, &this.lTimestamp[0])) {
         arm_2d_scene_player_switch_to_next_scene(ptScene->ptPlayer);
     }
 #endif
@@ -274,6 +281,23 @@ static void __before_scene_compass_switching_out(arm_2d_scene_t *ptScene)
 
 }
 
+static
+IMPL_PFB_ON_DRAW(__pfb_draw_compass_title)
+{
+    ARM_2D_PARAM(pTarget);
+    ARM_2D_PARAM(ptTile);
+    ARM_2D_PARAM(bIsNewFrame);
+
+    arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
+    arm_lcd_text_set_font(&ARM_2D_FONT_6x8.use_as__arm_2d_font_t);
+    arm_lcd_text_set_draw_region(NULL);
+    arm_lcd_text_set_colour(GLCD_COLOR_RED, GLCD_COLOR_WHITE);
+    arm_lcd_text_location(0,0);
+    arm_lcd_puts(c_chCompassTitle);
+
+    return arm_fsm_rt_cpl;
+}
+
 static
 IMPL_PFB_ON_DRAW(__pfb_draw_scene_compass_handler)
 {
@@ -318,13 +342,12 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_compass_handler)
 
 
         /* draw text at the top-left corner */
-
-        arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
-        arm_lcd_text_set_font(&ARM_2D_FONT_6x8.use_as__arm_2d_font_t);
-        arm_lcd_text_set_draw_region(NULL);
-        arm_lcd_text_set_colour(GLCD_COLOR_RED, GLCD_COLOR_WHITE);
-        arm_lcd_text_location(0,0);
-        arm_lcd_puts("Scene compass");
+    #if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+        if (!disp_adapter0_layer_cache_show(&this.tTitleLayer, ptTile, bIsNewFrame))
+    #endif
+        {
+            __pfb_draw_compass_title(ptThis, ptTile, bIsNewFrame);
+        }
 
     /*-----------------------draw the foreground end  -----------------------*/
     }
@@ -479,6 +502,36 @@ user_scene_compass_t *__arm_2d_scene_compass_init(  arm_2d_scene_player_t *ptDis
     } while(0);
 
 
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    /* cache the title, the white background is keyed out as the dial might 
+     * overlap it 
+     */
+    do {
+        disp_adapter0_layer_cache_cfg_t tCFG = {
+            .fnDrawLayer = &__pfb_draw_compass_title,
+            .pTarget = ptThis,
+            .tRegion = {
+                .tSize = {
+                    .iWidth = (sizeof(c_chCompassTitle) - 1) * 6,
+                    .iHeight = 8,
+                },
+            },
+            .tBackground = GLCD_COLOR_WHITE,
+            .bColourKeying = true,
+        };
+
+        /* the title is drawn directly when there is no memory for the cache */
+        if (ARM_2D_ERR_NONE != disp_adapter0_layer_cache_init(&this.tTitleLayer, &tCFG)) {
+            ARM_2D_LOG_WARNING(
+                APP, 
+                0, 
+                "Compass", 
+                "Failed to cache the title, it is drawn directly"
+            );
+        }
+    } while(0);
+#endif
+
     /* ------------   initialize members of user_scene_compass_t end   ---------------*/
 
     arm_2d_scene_player_append_scenes(  ptDispAdapter, 
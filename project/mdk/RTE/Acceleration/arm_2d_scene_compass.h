@@ -29,6 +29,7 @@
 
 #include "arm_2d_helper.h"
 #include "arm_2d_example_controls.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #ifdef   __cplusplus
 extern "C" {
@@ -92,6 +93,11 @@ ARM_PRIVATE(
     int16_t iDisplayAngle;
 
 )
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+ARM_PRIVATE(
+    disp_adapter0_layer_cache_t tTitleLayer;
+)
+#endif
     /* place your public member here */
     
 };
@@ -20,6 +20,7 @@
 
 #define __USER_SCENE_MATRIX_IMPLEMENT__
 #include "arm_2d_scene_matrix.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #if defined(RTE_Acceleration_Arm_2D_Helper_PFB)
 
@@ -191,7 +192,7 @@ static void __on_scene_matrix_load(arm_2d_scene_t *ptScene)
     user_scene_matrix_t *ptThis = (user_scene_matrix_t *)ptScene;
     ARM_2D_UNUSED(ptThis);
 
-    this.lTimestamp[0] = arm_2d_helper_get_system_timestamp();
+    this.lTimestamp[0] = disp_adapter0_get_scene_timestamp();
 
     arm_2d_helper_pfb_policy(&ptScene->ptPlayer->use_as__arm_2d_helper_pfb_t,
                              ARM_2D_PFB_SCAN_POLICY_VERTICAL_FIRST);
@@ -250,13 +251,13 @@ static void __on_scene_matrix_frame_start(arm_2d_scene_t *ptScene)
         = arm_2d_helper_pfb_get_display_area( 
             &ptScene->ptPlayer->use_as__arm_2d_helper_pfb_t);
 
-    int64_t lTimestamp = arm_2d_helper_get_system_timestamp();
+    int64_t lTimestamp = disp_adapter0_get_scene_timestamp();
     int64_t lDelta = lTimestamp - this.lTimestamp[0];
     int32_t nElapsedMs = arm_2d_helper_convert_ticks_to_ms(lDelta);
     this.lTimestamp[0] = lTimestamp;
 
     bool bUpdateLetters = false;
-    if (arm_2d_helper_is_time_out(50, &this.lTimestamp[1])) {
+    if (disp_adapter0_scene_is_time_out(50, &this.lTimestamp[1])) {
         bUpdateLetters = true;
     }
 
@@ -526,7 +527,7 @@ user_scene_matrix_t *__arm_2d_scene_matrix_init(
         }
 
         /* give each train a random start postion */
-        srand(arm_2d_helper_get_system_timestamp());
+        srand(disp_adapter0_get_scene_timestamp());
         arm_foreach(__letter_train_t, this.tTrains, ptTrain) {
             _->tRegion.tLocation.iY += rand() % ptTrain->tRegion.tSize.iHeight;
             _->tRegion.tLocation.iY -= ptTrain->tRegion.tSize.iHeight * 2;
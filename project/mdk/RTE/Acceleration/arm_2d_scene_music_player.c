@@ -20,6 +20,7 @@
 
 #define __USER_SCENE_MUSIC_PLAYER_IMPLEMENT__
 #include "arm_2d_scene_music_player.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #if defined(RTE_Acceleration_Arm_2D_Helper_PFB)
 
@@ -263,7 +264,7 @@ static void __fill_histogram_frame(__histogram_frame_t *ptFrame)
 {
     assert(NULL != ptFrame);
 
-    srand(arm_2d_helper_get_system_timestamp());
+    srand(disp_adapter0_get_scene_timestamp());
 
     int_fast16_t n = dimof((*ptFrame));
     uint8_t *pchBin = *ptFrame;
@@ -299,7 +300,7 @@ static void __on_scene_music_player_frame_start(arm_2d_scene_t *ptScene)
 
     do {
         int32_t nResult;
-        if (arm_2d_helper_time_liner_slider(0, 3599, 30000, &nResult, &this.lTimestamp[0])) {
+        if (disp_adapter0_scene_time_liner_slider(0, 3599, 30000, &nResult, &this.lTimestamp[0])) {
             this.lTimestamp[0] = 0;
         }
 
@@ -309,10 +310,10 @@ static void __on_scene_music_player_frame_start(arm_2d_scene_t *ptScene)
 
     } while(0);
 
-    if (arm_2d_helper_time_liner_slider_i64(-this.Lyrics.tSize.iHeight, 
-                                            this.Lyrics.lFullHeight, 
-                                            this.nMusicTimeInMs,
-                                            &this.Lyrics.lPosition,
+    if (disp_adapter0_scene_time_liner_slider_i64(-this.Lyrics.tSize.iHeight, 
+                                                  this.Lyrics.lFullHeight, 
+                                                  this.nMusicTimeInMs,
+                                                  &this.Lyrics.lPosition,
                                             &this.lTimestamp[1])) {
 
         this.lTimestamp[1] = 0;
@@ -323,7 +324,7 @@ static void __on_scene_music_player_frame_start(arm_2d_scene_t *ptScene)
                                          this.Lyrics.lPosition);
 
         int32_t nElapsedMs = arm_2d_helper_convert_ticks_to_ms(
-                arm_2d_helper_get_system_timestamp() - this.lTimestamp[1]
+                disp_adapter0_get_scene_timestamp() - this.lTimestamp[1]
             );
 
         if ((this.nMusicTimeInMs - nElapsedMs) > (255 << 3)) {
@@ -352,7 +353,7 @@ static void __on_scene_music_player_frame_start(arm_2d_scene_t *ptScene)
         this.iPlayProgress = ((int64_t)nElapsedMs * 1000) / (int64_t)this.nMusicTimeInMs;
     }
 
-    if (arm_2d_helper_is_time_out(33, &this.lTimestamp[2])) {
+    if (disp_adapter0_scene_is_time_out(33, &this.lTimestamp[2])) {
         static __histogram_frame_t s_tDemoFrame;
 
         __fill_histogram_frame(&s_tDemoFrame);
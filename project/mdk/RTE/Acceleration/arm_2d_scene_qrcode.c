@@ -20,6 +20,7 @@
 
 #define __USER_SCENE_QRCODE_IMPLEMENT__
 #include "arm_2d_scene_qrcode.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #if defined(RTE_Acceleration_Arm_2D_Helper_PFB)
 
@@ -158,7 +159,7 @@ static void __on_scene_qrcode_frame_complete(arm_2d_scene_t *ptScene)
 
 #if 0
     /* switch to next scene after 3s */
-    if (arm_2d_helper_is_time_out(3000, &this.lTimestamp[0])) {
+    if (disp_adapter0_scene_is_time_out(3000, &this.lTimestamp[0])) {
         arm_2d_scene_player_switch_to_next_scene(ptScene->ptPlayer);
     }
 #endif
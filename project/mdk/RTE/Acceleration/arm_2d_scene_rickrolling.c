@@ -20,6 +20,7 @@
 
 #define __USER_SCENE_RICKROLLING_IMPLEMENT__
 #include "arm_2d_scene_rickrolling.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #if defined(RTE_Acceleration_Arm_2D_Helper_PFB)                                 \
  && defined(RTE_Acceleration_Arm_2D_Extra_TJpgDec_Loader)
@@ -144,7 +145,7 @@ static void __on_scene_rickrolling_frame_start(arm_2d_scene_t *ptScene)
     user_scene_rickrolling_t *ptThis = (user_scene_rickrolling_t *)ptScene;
     ARM_2D_UNUSED(ptThis);
 
-    if (arm_2d_helper_is_time_out( this.tFilm.hwPeriodPerFrame , &this.lTimestamp[0])) {
+    if (disp_adapter0_scene_is_time_out( this.tFilm.hwPeriodPerFrame , &this.lTimestamp[0])) {
 
         arm_2d_helper_film_next_frame(&this.tFilm);
     }
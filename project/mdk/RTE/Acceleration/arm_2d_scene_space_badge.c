@@ -20,6 +20,7 @@
 
 #define __USER_SCENE_SPACE_BADGE_IMPLEMENT__
 #include "arm_2d_scene_space_badge.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #if defined(RTE_Acceleration_Arm_2D_Helper_PFB)
 
@@ -140,7 +141,7 @@ static void __on_scene_space_badge_load(arm_2d_scene_t *ptScene)
     do {
         arm_2d_size_t tBattleZone = c_tileSpaceFleet.tRegion.tSize;
 
-        srand(arm_2d_helper_get_system_timestamp());
+        srand(disp_adapter0_get_scene_timestamp());
         arm_foreach(__space_badge_explosion_halo_t, this.tHalos, ptHalo) {
 
             ptHalo->tPivot.iX = rand() % tBattleZone.iWidth;
@@ -170,9 +171,7 @@ static void __on_scene_space_badge_depose(arm_2d_scene_t *ptScene)
     /*--------------------- insert your depose code begin --------------------*/
     /* draw line */
     do {
-        arm_foreach(arm_2d_user_draw_line_descriptor_t, this.tDrawLineOP, ptLineOP) {
-            ARM_2D_OP_DEPOSE(*ptLineOP);
-        }
+        ARM_2D_OP_DEPOSE(this.tDrawLinesOP);
     } while(0);
 
     crt_screen_depose(&this.tCRTScreen);
@@ -181,6 +180,10 @@ static void __on_scene_space_badge_depose(arm_2d_scene_t *ptScene)
     dynamic_nebula_depose(&this.tNebula);
 #endif
 
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    disp_adapter0_layer_cache_depose(&this.tGridLayer);
+#endif
+
     /*---------------------- insert your depose code end  --------------------*/
 
     arm_foreach(int64_t,this.lTimestamp, ptItem) {
@@ -218,7 +221,7 @@ static void __on_scene_space_badge_frame_start(arm_2d_scene_t *ptScene)
 
     crt_screen_on_frame_start(&this.tCRTScreen);
 
-    if (arm_2d_helper_is_time_out(30, &this.lTimestamp[0])) {
+    if (disp_adapter0_scene_is_time_out(30, &this.lTimestamp[0])) {
 
         if (this.iStartOffset <= 0) {
             this.iStartOffset = 100;
@@ -227,7 +230,7 @@ static void __on_scene_space_badge_frame_start(arm_2d_scene_t *ptScene)
 
         arm_2d_size_t tBattleZone = c_tileSpaceFleet.tRegion.tSize;
 
-        srand(arm_2d_helper_get_system_timestamp());
+        srand(disp_adapter0_get_scene_timestamp());
         arm_foreach(__space_badge_explosion_halo_t, this.tHalos, ptHalo) {
 
             if (ptHalo->chOpacity == 0) {
@@ -254,7 +257,7 @@ static void __on_scene_space_badge_frame_complete(arm_2d_scene_t *ptScene)
     crt_screen_on_frame_complete(&this.tCRTScreen);
 #if 0
     /* switch to next scene after 3s */
-    if (arm_2d_helper_is_time_out(3000, &this.lTimestamp[0])) {
+    if (disp_adapter0_scene_is_time_out(3000, &this.lTimestamp[0])) {
         arm_2d_scene_player_switch_to_next_scene(ptScene->ptPlayer);
     }
 #endif
@@ -268,48 +271,81 @@ static void __before_scene_space_badge_switching_out(arm_2d_scene_t *ptScene)
 }
 
 static
-IMPL_PFB_ON_DRAW(__pfb_draw_scene_space_badge_handler)
+IMPL_PFB_ON_DRAW(__pfb_draw_perspective_grid)
 {
     ARM_2D_PARAM(pTarget);
     ARM_2D_PARAM(ptTile);
     ARM_2D_PARAM(bIsNewFrame);
 
     user_scene_space_badge_t *ptThis = (user_scene_space_badge_t *)pTarget;
+    arm_2d_size_t tLayerSize = ptTile->tRegion.tSize;
 
-    arm_2d_canvas(ptTile, __top_canvas) {
-    /*-----------------------draw the scene begin-----------------------*/
+    arm_2d_canvas(ptTile, __grid_canvas) {
 
+        /* the vanishing point is at the top centre of the lower half screen */
         arm_2d_location_t tStartPoint = {
-            .iY = __top_canvas.tSize.iHeight - 1,
-            .iX = (__top_canvas.tSize.iWidth >> 1) - 200 * 8,
+            .iY = tLayerSize.iHeight - 1,
+            .iX = (tLayerSize.iWidth >> 1) - 200 * 8,
         };
         arm_2d_location_t tStopPoint = {
-            .iY = __top_canvas.tSize.iHeight >> 1,
-            .iX = __top_canvas.tSize.iWidth >> 1,
+            .iY = 0,
+            .iX = tLayerSize.iWidth >> 1,
         };
 
-        for (int n = 0; n < 16; n++) {
+        /* draw the perspective grid with one op */
+        do {
+            arm_2d_user_draw_line_api_params_t tLines[16];
+
+            arm_foreach(arm_2d_user_draw_line_api_params_t, tLines, ptLine) {
+                ptLine->tStart = tStartPoint;
+                ptLine->tEnd = tStopPoint;
+
+                tStartPoint.iX += 200;
+            }
+
+            arm_2d_user_draw_lines_api_params_t tParam = {
+                .ptLines = tLines,
+                .hwCount = dimof(tLines),
+            };
 
-            /* draw line*/
-            do {
-                arm_2d_user_draw_line_api_params_t tParam = {
-                    .tStart = tStartPoint,
-                    .tEnd = tStopPoint,
-                };
+            arm_2dp_rgb565_user_draw_lines(
+                            &this.tDrawLinesOP,
+                            ptTile,
+                            &__grid_canvas,
+                            &tParam,
+                            (arm_2d_color_rgb565_t){GLCD_COLOR_GREEN},
+                            255);
+        } while(0);
+        ARM_2D_OP_WAIT_ASYNC(&this.tDrawLinesOP);
+    }
+
+    return arm_fsm_rt_cpl;
+}
+
+static
+IMPL_PFB_ON_DRAW(__pfb_draw_scene_space_badge_handler)
+{
+    ARM_2D_PARAM(pTarget);
+    ARM_2D_PARAM(ptTile);
+    ARM_2D_PARAM(bIsNewFrame);
 
-                arm_2dp_rgb565_user_draw_line(
-                                &this.tDrawLineOP[n],
-                                ptTile,
-                                &__top_canvas,
-                                &tParam,
-                                (arm_2d_color_rgb565_t){GLCD_COLOR_GREEN},
-                                255);
-            } while(0);
-            ARM_2D_OP_WAIT_ASYNC(&this.tDrawLineOP[n]);
+    user_scene_space_badge_t *ptThis = (user_scene_space_badge_t *)pTarget;
 
+    arm_2d_canvas(ptTile, __top_canvas) {
+    /*-----------------------draw the scene begin-----------------------*/
 
-            tStartPoint.iX += 200;
+        /* the perspective grid never changes */
+    #if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+        disp_adapter0_layer_cache_show(&this.tGridLayer, ptTile, bIsNewFrame);
+    #else
+        arm_2d_dock_bottom(__top_canvas,
+                           __top_canvas.tSize.iHeight 
+                        - (__top_canvas.tSize.iHeight >> 1)) {
+            arm_2d_container(ptTile, __grid_layer, &__bottom_region) {
+                __pfb_draw_perspective_grid(ptThis, &__grid_layer, bIsNewFrame);
+            }
         }
+    #endif
 
         /* draw horizontal line */
         int32_t nCellLength = 100;
@@ -363,31 +399,41 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_space_badge_handler)
                                                                     &__bottom_centre_region, 
                                                                     255 - 32);
 
-                arm_foreach(__space_badge_explosion_halo_t, this.tHalos, ptHalo) {
-                    /* draw circle */
+                /* draw all halos with one batch */
+                do {
+                    arm_2d_user_circle_t tCircles[dimof(this.tHalos)];
+                    uint_fast16_t hwCount = 0;
 
-                    arm_2d_location_t tPivot = ptHalo->tPivot;
-                    tPivot.iX += __bottom_centre_region.tLocation.iX;
-                    tPivot.iY += __bottom_centre_region.tLocation.iY;
+                    arm_foreach(__space_badge_explosion_halo_t, this.tHalos, ptHalo) {
+                        if (0 == ptHalo->chOpacity) {
+                            continue;
+                        }
 
+                        tCircles[hwCount++] = (arm_2d_user_circle_t) {
+                            .tPivot = {
+                                .iX = ptHalo->tPivot.iX + __bottom_centre_region.tLocation.iX,
+                                .iY = ptHalo->tPivot.iY + __bottom_centre_region.tLocation.iY,
+                            },
+                            .iRadius = ptHalo->iRadius,
+                            .wColour = __RGB( 255, 200, 0),
+                            .chOpacity = ptHalo->chOpacity,
+                        };
+                    }
 
-                    arm_2d_user_draw_circle_api_params_t tParam = {
-                        .iRadius = ptHalo->iRadius,
+                    arm_2d_user_draw_circles_api_params_t tParam = {
+                        .ptCircles = tCircles,
+                        .hwCount = hwCount,
                         .bAntiAlias = true,
-                        .ptPivot = &tPivot,
                     };
 
-                    arm_2dp_rgb565_user_draw_circle(
-                                    NULL,
-                                    ptTile,
-                                    &__top_canvas,
-                                    &tParam,
-                                    (arm_2d_color_rgb565_t){__RGB( 255, 200, 0)},
-                                    ptHalo->chOpacity);
-                    
-                    ARM_2D_OP_WAIT_ASYNC();
+                    arm_2dp_rgb565_user_draw_circles(   NULL,
+                                                        ptTile,
+                                                        &__top_canvas,
+                                                        &tParam);
 
-                }
+                    /* tCircles must stay alive until the op completes */
+                    ARM_2D_OP_WAIT_ASYNC();
+                } while(0);
             }
         }
 
@@ -542,9 +588,7 @@ user_scene_space_badge_t *__arm_2d_scene_space_badge_init(   arm_2d_scene_player
     /* ------------   initialize members of user_scene_space_badge_t begin ---------------*/
     /* draw line */
     do {
-        arm_foreach(arm_2d_user_draw_line_descriptor_t, this.tDrawLineOP, ptLineOP) {
-            ARM_2D_OP_INIT(*ptLineOP);
-        }
+        ARM_2D_OP_INIT(this.tDrawLinesOP);
     } while(0);
 
     /* CRT Screen */
@@ -564,6 +608,37 @@ user_scene_space_badge_t *__arm_2d_scene_space_badge_init(   arm_2d_scene_player
         crt_screen_init(&this.tCRTScreen, &tCFG);
     } while(0);
 
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    /* cache the perspective grid in the lower half of the screen */
+    do {
+        disp_adapter0_layer_cache_cfg_t tCFG = {
+            .fnDrawLayer = &__pfb_draw_perspective_grid,
+            .pTarget = ptThis,
+            .tRegion = {
+                .tLocation = {
+                    .iY = __top_canvas.tSize.iHeight >> 1,
+                },
+                .tSize = {
+                    .iWidth = __top_canvas.tSize.iWidth,
+                    .iHeight = __top_canvas.tSize.iHeight
+                             - (__top_canvas.tSize.iHeight >> 1),
+                },
+            },
+            .tBackground = GLCD_COLOR_BLACK,
+        };
+
+        /* the grid is drawn directly when there is no memory for the cache */
+        if (ARM_2D_ERR_NONE != disp_adapter0_layer_cache_init(&this.tGridLayer, &tCFG)) {
+            ARM_2D_LOG_WARNING(
+                APP, 
+                0, 
+                "Space Badge", 
+                "Failed to cache the perspective grid, it is drawn directly"
+            );
+        }
+    } while(0);
+#endif
+
 #if SPACE_BADGE_SHOW_NEBULA
     do {
         int16_t iRadius = MIN(__top_canvas.tSize.iHeight, __top_canvas.tSize.iWidth) >> 1;
@@ -32,6 +32,7 @@
 
 #include "arm_2d_user_opcode_draw_line.h"
 #include "arm_2d_user_opcode_draw_circle.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #ifdef   __cplusplus
 extern "C" {
@@ -116,7 +117,7 @@ ARM_PRIVATE(
 
     crt_screen_t tCRTScreen;
 
-    arm_2d_user_draw_line_descriptor_t tDrawLineOP[16];
+    arm_2d_user_draw_lines_descriptor_t tDrawLinesOP;
     __space_badge_explosion_halo_t tHalos[16];
 
 #if SPACE_BADGE_SHOW_NEBULA
@@ -124,6 +125,11 @@ ARM_PRIVATE(
     dynamic_nebula_particle_t tParticles[8];
 #endif
 )
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+ARM_PRIVATE(
+    disp_adapter0_layer_cache_t tGridLayer;
+)
+#endif
     /* place your public member here */
     
 };
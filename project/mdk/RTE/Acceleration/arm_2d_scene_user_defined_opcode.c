@@ -134,10 +134,12 @@ static void __on_scene_user_defined_opcode_depose(arm_2d_scene_t *ptScene)
     
     /* draw line */
     do {
-        arm_foreach(arm_2d_user_draw_line_descriptor_t, this.tDrawLineOP, ptLineOP) {
-            ARM_2D_OP_DEPOSE(*ptLineOP);
-        }
+        ARM_2D_OP_DEPOSE(this.tDrawLinesOP);
     } while(0);
+
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    disp_adapter0_layer_cache_depose(&this.tGridLayer);
+#endif
     
     arm_foreach(int64_t,this.lTimestamp, ptItem) {
         *ptItem = 0;
@@ -191,7 +193,7 @@ static void __on_scene_user_defined_opcode_frame_start(arm_2d_scene_t *ptScene)
         
         case BATTLESHIP_HYPER_JUMP: {
                 int32_t nResult;
-                if (arm_2d_helper_time_half_cos_slider(500, 0, 4000, &nResult, &this.lTimestamp[0])) {
+                if (disp_adapter0_scene_time_half_cos_slider(500, 0, 4000, &nResult, &this.lTimestamp[0])) {
                     this.chBattleshipState = BATTLESHIP_BATTLE;
                     this.lTimestamp[0] = 0;
                 }
@@ -200,7 +202,7 @@ static void __on_scene_user_defined_opcode_frame_start(arm_2d_scene_t *ptScene)
             break;
         
         case BATTLESHIP_BATTLE:
-            srand(arm_2d_helper_get_system_timestamp());
+            srand(disp_adapter0_get_scene_timestamp());
             arm_foreach(__explosion_halo_t, this.tHalos, ptHalo) {
 
                 if (ptHalo->chOpacity == 0) {
@@ -216,7 +218,7 @@ static void __on_scene_user_defined_opcode_frame_start(arm_2d_scene_t *ptScene)
                     ptHalo->chOpacity = 0;
                 }
             }
-            if (arm_2d_helper_is_time_out(10000, &this.lTimestamp[0])) {
+            if (disp_adapter0_scene_is_time_out(10000, &this.lTimestamp[0])) {
                 this.lTimestamp[0] = 0;
                 this.chBattleshipState = BATTLESHIP_EXPLOSION;
                 this.iExplosionRadius = 0;
@@ -226,7 +228,7 @@ static void __on_scene_user_defined_opcode_frame_start(arm_2d_scene_t *ptScene)
         case BATTLESHIP_EXPLOSION:
             {
                 int32_t nResult;
-                if (arm_2d_helper_time_half_cos_slider(0, 80, 8000, &nResult, &this.lTimestamp[0])) {
+                if (disp_adapter0_scene_time_half_cos_slider(0, 80, 8000, &nResult, &this.lTimestamp[0])) {
                     this.chBattleshipState = BATTLESHIP_VANISH;
                     this.lTimestamp[0] = 0;
                 }
@@ -241,7 +243,7 @@ static void __on_scene_user_defined_opcode_frame_start(arm_2d_scene_t *ptScene)
 
             }
 
-            srand(arm_2d_helper_get_system_timestamp());
+            srand(disp_adapter0_get_scene_timestamp());
             arm_foreach(__explosion_halo_t, this.tHalos, ptHalo) {
 
                 if (ptHalo->chOpacity == 0) {
@@ -262,7 +264,7 @@ static void __on_scene_user_defined_opcode_frame_start(arm_2d_scene_t *ptScene)
         case BATTLESHIP_VANISH:
             {
                 int32_t nResult;
-                if (arm_2d_helper_time_half_cos_slider(80, 0, 500, &nResult, &this.lTimestamp[0])) {
+                if (disp_adapter0_scene_time_half_cos_slider(80, 0, 500, &nResult, &this.lTimestamp[0])) {
                     this.chBattleshipState = BATTLESHIP_IDLE;
                     this.lTimestamp[0] = 0;
                 }
@@ -271,7 +273,7 @@ static void __on_scene_user_defined_opcode_frame_start(arm_2d_scene_t *ptScene)
             break;
         
         case BATTLESHIP_IDLE:
-            if (arm_2d_helper_is_time_out(5000, &this.lTimestamp[0])) {
+            if (disp_adapter0_scene_is_time_out(5000, &this.lTimestamp[0])) {
                 this.chBattleshipState = BATTLESHIP_START;
             }
             break;
@@ -286,7 +288,7 @@ static void __on_scene_user_defined_opcode_frame_complete(arm_2d_scene_t *ptScen
 
 #if 0
     /* switch to next scene after 3s */
-    if (arm_2d_helper_is_time_out(3000, &this.lTimestamp[0])) {
+    if (disp_adapter0_scene_is_time_out(3000, &this.lTimestamp[0])) {
         arm_2d_scene_player_switch_to_next_scene(ptScene->ptPlayer);
     }
 #endif
@@ -300,51 +302,83 @@ static void __before_scene_user_defined_opcode_switching_out(arm_2d_scene_t *ptS
 }
 
 static
-IMPL_PFB_ON_DRAW(__pfb_draw_scene_user_defined_opcode_handler)
+IMPL_PFB_ON_DRAW(__pfb_draw_perspective_grid)
 {
     ARM_2D_PARAM(pTarget);
     ARM_2D_PARAM(ptTile);
     ARM_2D_PARAM(bIsNewFrame);
 
     user_scene_user_defined_opcode_t *ptThis = (user_scene_user_defined_opcode_t *)pTarget;
-    arm_2d_size_t tScreenSize = ptTile->tRegion.tSize;
-
-    ARM_2D_UNUSED(tScreenSize);
+    arm_2d_size_t tLayerSize = ptTile->tRegion.tSize;
 
-    arm_2d_canvas(ptTile, __top_canvas) {
-    /*-----------------------draw the foreground begin-----------------------*/
+    arm_2d_canvas(ptTile, __grid_canvas) {
 
+        /* the vanishing point is at the top centre of the lower half screen */
         arm_2d_location_t tStartPoint = {
-            .iY = tScreenSize.iHeight - 1,
-            .iX = (tScreenSize.iWidth >> 1) - 200 * 8,
+            .iY = tLayerSize.iHeight - 1,
+            .iX = (tLayerSize.iWidth >> 1) - 200 * 8,
         };
         arm_2d_location_t tStopPoint = {
-            .iY = tScreenSize.iHeight >> 1,
-            .iX = tScreenSize.iWidth >> 1,
+            .iY = 0,
+            .iX = tLayerSize.iWidth >> 1,
         };
 
-        for (int n = 0; n < 16; n++) {
+        /* draw the perspective grid with one op */
+        do {
+            arm_2d_user_draw_line_api_params_t tLines[16];
 
-            /* draw line*/
-            do {
-                arm_2d_user_draw_line_api_params_t tParam = {
-                    .tStart = tStartPoint,
-                    .tEnd = tStopPoint,
-                };
+            arm_foreach(arm_2d_user_draw_line_api_params_t, tLines, ptLine) {
+                ptLine->tStart = tStartPoint;
+                ptLine->tEnd = tStopPoint;
 
-                arm_2dp_rgb565_user_draw_line(
-                                &this.tDrawLineOP[n],
-                                ptTile,
-                                &__top_canvas,
-                                &tParam,
-                                (arm_2d_color_rgb565_t){GLCD_COLOR_GREEN},
-                                255);
-            } while(0);
-            ARM_2D_OP_WAIT_ASYNC(&this.tDrawLineOP[n]);
+                tStartPoint.iX += 200;
+            }
+
+            arm_2d_user_draw_lines_api_params_t tParam = {
+                .ptLines = tLines,
+                .hwCount = dimof(tLines),
+            };
+
+            arm_2dp_rgb565_user_draw_lines(
+                            &this.tDrawLinesOP,
+                            ptTile,
+                            &__grid_canvas,
+                            &tParam,
+                            (arm_2d_color_rgb565_t){GLCD_COLOR_GREEN},
+                            255);
+        } while(0);
+        ARM_2D_OP_WAIT_ASYNC(&this.tDrawLinesOP);
+    }
+
+    return arm_fsm_rt_cpl;
+}
+
+static
+IMPL_PFB_ON_DRAW(__pfb_draw_scene_user_defined_opcode_handler)
+{
+    ARM_2D_PARAM(pTarget);
+    ARM_2D_PARAM(ptTile);
+    ARM_2D_PARAM(bIsNewFrame);
+
+    user_scene_user_defined_opcode_t *ptThis = (user_scene_user_defined_opcode_t *)pTarget;
+    arm_2d_size_t tScreenSize = ptTile->tRegion.tSize;
+
+    ARM_2D_UNUSED(tScreenSize);
 
+    arm_2d_canvas(ptTile, __top_canvas) {
+    /*-----------------------draw the foreground begin-----------------------*/
 
-            tStartPoint.iX += 200;
+        /* the perspective grid never changes */
+    #if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+        disp_adapter0_layer_cache_show(&this.tGridLayer, ptTile, bIsNewFrame);
+    #else
+        arm_2d_dock_bottom(__top_canvas,
+                           tScreenSize.iHeight - (tScreenSize.iHeight >> 1)) {
+            arm_2d_container(ptTile, __grid_layer, &__bottom_region) {
+                __pfb_draw_perspective_grid(ptThis, &__grid_layer, bIsNewFrame);
+            }
         }
+    #endif
 
         /* draw horizontal line */
         int32_t nCellLength = 100;
@@ -437,31 +471,39 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_user_defined_opcode_handler)
 
                     } else if (BATTLESHIP_BATTLE == this.chBattleshipState 
                             || BATTLESHIP_EXPLOSION == this.chBattleshipState) {
-                        arm_foreach(__explosion_halo_t, this.tHalos, ptHalo) {
-                            /* draw circle */
-
-                            arm_2d_location_t tPivot = ptHalo->tPivot;
-                            tPivot.iX += __centre_region.tLocation.iX;
-                            tPivot.iY += __centre_region.tLocation.iY;
-
+                        /* draw all halos with one batch */
+                        arm_2d_user_circle_t tCircles[dimof(this.tHalos)];
+                        uint_fast16_t hwCount = 0;
 
-                            arm_2d_user_draw_circle_api_params_t tParam = {
+                        arm_foreach(__explosion_halo_t, this.tHalos, ptHalo) {
+                            if (0 == ptHalo->chOpacity) {
+                                continue;
+                            }
+
+                            tCircles[hwCount++] = (arm_2d_user_circle_t) {
+                                .tPivot = {
+                                    .iX = ptHalo->tPivot.iX + __centre_region.tLocation.iX,
+                                    .iY = ptHalo->tPivot.iY + __centre_region.tLocation.iY,
+                                },
                                 .iRadius = ptHalo->iRadius,
-                                .bAntiAlias = true,
-                                .ptPivot = &tPivot,
+                                .wColour = __RGB( 255, 200, 0),
+                                .chOpacity = ptHalo->chOpacity,
                             };
+                        }
 
-                            arm_2dp_rgb565_user_draw_circle(
-                                            NULL,
-                                            ptTile,
-                                            &__top_canvas,
-                                            &tParam,
-                                            (arm_2d_color_rgb565_t){__RGB( 255, 200, 0)},
-                                            ptHalo->chOpacity);
-                            
-                            ARM_2D_OP_WAIT_ASYNC();
+                        arm_2d_user_draw_circles_api_params_t tParam = {
+                            .ptCircles = tCircles,
+                            .hwCount = hwCount,
+                            .bAntiAlias = true,
+                        };
 
-                        }
+                        arm_2dp_rgb565_user_draw_circles(   NULL,
+                                                            ptTile,
+                                                            &__top_canvas,
+                                                            &tParam);
+
+                        /* tCircles must stay alive until the op completes */
+                        ARM_2D_OP_WAIT_ASYNC();
                     }
 
                     if ((BATTLESHIP_EXPLOSION == this.chBattleshipState)
@@ -586,10 +628,39 @@ user_scene_user_defined_opcode_t *__arm_2d_scene_user_defined_opcode_init(   arm
     /* ------------   initialize members of user_scene_user_defined_opcode_t begin ---------------*/
     /* draw line */
     do {
-        arm_foreach(arm_2d_user_draw_line_descriptor_t, this.tDrawLineOP, ptLineOP) {
-            ARM_2D_OP_INIT(*ptLineOP);
+        ARM_2D_OP_INIT(this.tDrawLinesOP);
+    } while(0);
+
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    /* cache the perspective grid in the lower half of the screen */
+    do {
+        disp_adapter0_layer_cache_cfg_t tCFG = {
+            .fnDrawLayer = &__pfb_draw_perspective_grid,
+            .pTarget = ptThis,
+            .tRegion = {
+                .tLocation = {
+                    .iY = __DISP0_CFG_SCEEN_HEIGHT__ >> 1,
+                },
+                .tSize = {
+                    .iWidth = __DISP0_CFG_SCEEN_WIDTH__,
+                    .iHeight = __DISP0_CFG_SCEEN_HEIGHT__
+                             - (__DISP0_CFG_SCEEN_HEIGHT__ >> 1),
+                },
+            },
+            .tBackground = GLCD_COLOR_BLACK,
+        };
+
+        /* the grid is drawn directly when there is no memory for the cache */
+        if (ARM_2D_ERR_NONE != disp_adapter0_layer_cache_init(&this.tGridLayer, &tCFG)) {
+            ARM_2D_LOG_WARNING(
+                APP, 
+                0, 
+                "Demo", 
+                "Failed to cache the perspective grid, it is drawn directly"
+            );
         }
     } while(0);
+#endif
 
     /* ------------   initialize members of user_scene_user_defined_opcode_t end   ---------------*/
 
@@ -33,6 +33,7 @@
 
 #include "arm_2d_user_opcode_draw_line.h"
 #include "arm_2d_user_opcode_draw_circle.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #ifdef   __cplusplus
 extern "C" {
@@ -103,10 +104,15 @@ ARM_PRIVATE(
     int16_t iExplosionRadius;
     COLOUR_TYPE_T tExplosion;
 
-    arm_2d_user_draw_line_descriptor_t tDrawLineOP[16];
+    arm_2d_user_draw_lines_descriptor_t tDrawLinesOP;
 
     __explosion_halo_t tHalos[16];
 )
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+ARM_PRIVATE(
+    disp_adapter0_layer_cache_t tGridLayer;
+)
+#endif
     /* place your public member here */
     
 };
@@ -27,6 +27,7 @@
 
 #define __USER_SCENE_WATCH_FACE_01_IMPLEMENT__
 #include "arm_2d_scene_watch_face_01.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #include "arm_2d_helper.h"
 #include "arm_2d_example_controls.h"
@@ -161,6 +162,10 @@ static void __on_scene_watch_face_01_depose(arm_2d_scene_t *ptScene)
     }
 
     cloudy_glass_depose(&this.tCloudyGlass);
+
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    disp_adapter0_layer_cache_depose(&this.tPanelLayer);
+#endif
     
     /* reset timestamp */
     arm_foreach(int64_t,this.lTimestamp, ptItem) {
@@ -198,7 +203,7 @@ static void __on_scene_watch_face_01_frame_start(arm_2d_scene_t *ptScene)
     ARM_2D_UNUSED(ptThis);
 
     int64_t lTimeStampInMs = arm_2d_helper_convert_ticks_to_ms(
-                                arm_2d_helper_get_system_timestamp());
+                                disp_adapter0_get_scene_timestamp());
 
     /* calculate the hours */
     do {
@@ -238,11 +243,11 @@ static void __on_scene_watch_face_01_frame_start(arm_2d_scene_t *ptScene)
     /* update cloud colour */
     do {
         int32_t nResult;
-        if (arm_2d_helper_time_liner_slider(0, 1000, 5000, &nResult, &this.lTimestamp[1])) {
+        if (disp_adapter0_scene_time_liner_slider(0, 1000, 5000, &nResult, &this.lTimestamp[1])) {
             this.lTimestamp[1] = 0;
             this.wPreviousColour = c_wColourTable[this.chColourTableIndex];
 
-            srand((uint32_t)arm_2d_helper_get_system_timestamp());
+            srand((uint32_t)disp_adapter0_get_scene_timestamp());
             this.chColourTableIndex = rand() % dimof(c_wColourTable);
             nResult = 0;
         }
@@ -274,7 +279,7 @@ static void __on_scene_watch_face_01_frame_complete(arm_2d_scene_t *ptScene)
 
 #if 0
     /* switch to next scene after 30s */
-    if (arm_2d_helper_is_time_out(30000, &this.lTimestamp[0])) {
+    if (disp_adapter0_scene_is_time_out(30000, &this.lTimestamp[0])) {
         arm_2d_scene_player_switch_to_next_scene(ptScene->ptPlayer);
     }
 #endif
@@ -290,14 +295,15 @@ static void __before_scene_watch_face_01_switching_out(arm_2d_scene_t *ptScene)
 static
 void __draw_watch_panel(const arm_2d_tile_t *ptTile, 
                         const arm_2d_region_t *ptRegion, 
-                        user_scene_watch_face_01_t *ptThis)
+                        user_scene_watch_face_01_t *ptThis,
+                        uint8_t chOpacity)
 {
     arm_2d_container(ptTile, __panel, ptRegion) {
 
         arm_2d_align_centre_open(__panel_canvas, 200, 200) {
             arm_2d_size_t tDigitsSize = arm_lcd_get_string_line_box("00", &ARM_2D_FONT_ALARM_CLOCK_32_A4);
 
-            arm_lcd_text_set_opacity(32);
+            arm_lcd_text_set_opacity(chOpacity);
             for (int_fast8_t n = 0; n < dimof(s_tDigitsTable); n++) {
                 arm_2d_region_t tDigitsRegion = {
                     .tLocation = __centre_region.tLocation, //s_tDigitsTable[n].tLocation,
@@ -326,6 +332,25 @@ void __draw_watch_panel(const arm_2d_tile_t *ptTile,
 }
 
 
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+static
+IMPL_PFB_ON_DRAW(__pfb_draw_watch_panel_layer)
+{
+    ARM_2D_PARAM(pTarget);
+    ARM_2D_PARAM(ptTile);
+    ARM_2D_PARAM(bIsNewFrame);
+
+    user_scene_watch_face_01_t *ptThis = (user_scene_watch_face_01_t *)pTarget;
+
+    arm_2d_canvas(ptTile, __layer_canvas) {
+        /* the cached panel is opaque, it is blended when restored */
+        __draw_watch_panel(ptTile, &__layer_canvas, ptThis, 255);
+    }
+
+    return arm_fsm_rt_cpl;
+}
+#endif
+
 static
 IMPL_PFB_ON_DRAW(__pfb_draw_scene_watch_face_01_handler)
 {
@@ -345,7 +370,12 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_watch_face_01_handler)
                               ptTile,
                               &__centre_region);
 
-            __draw_watch_panel(ptTile, &__centre_region, ptThis);
+        #if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+            if (!disp_adapter0_layer_cache_show(&this.tPanelLayer, ptTile, bIsNewFrame))
+        #endif
+            {
+                __draw_watch_panel(ptTile, &__centre_region, ptThis, 32);
+            }
 
             arm_foreach(spin_zoom_widget_t, this.tPointers, ptPointer) {
                 spin_zoom_widget_show(  ptPointer, 
@@ -535,6 +565,39 @@ user_scene_watch_face_01_t *__arm_2d_scene_watch_face_01_init(   arm_2d_scene_pl
 
     this.wPreviousColour = c_wColourTable[this.chColourTableIndex++];
 
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+    /* cache the digits of the panel, they are blended onto the cloudy glass
+     * with the black background keyed out. The anti-aliased edges of the 
+     * digits are slightly darker than drawing them directly.
+     */
+    do {
+        arm_2d_region_t tScreen
+            = arm_2d_helper_pfb_get_display_area(
+                &ptDispAdapter->use_as__arm_2d_helper_pfb_t);
+
+        arm_2d_align_centre(tScreen, 240, 240) {
+            disp_adapter0_layer_cache_cfg_t tCFG = {
+                .fnDrawLayer = &__pfb_draw_watch_panel_layer,
+                .pTarget = ptThis,
+                .tRegion = __centre_region,
+                .tBackground = GLCD_COLOR_BLACK,
+                .bColourKeying = true,
+                .chOpacity = 32,
+            };
+
+            /* the panel is drawn directly when there is no memory for the cache */
+            if (ARM_2D_ERR_NONE != disp_adapter0_layer_cache_init(&this.tPanelLayer, &tCFG)) {
+                ARM_2D_LOG_WARNING(
+                    APP, 
+                    0, 
+                    "Watch Face", 
+                    "Failed to cache the panel, it is drawn directly"
+                );
+            }
+        }
+    } while(0);
+#endif
+
     /* ------------   initialize members of user_scene_ruler_t end   ---------------*/
 
     arm_2d_scene_player_append_scenes(  ptDispAdapter, 
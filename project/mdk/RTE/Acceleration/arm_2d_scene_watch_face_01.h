@@ -31,6 +31,7 @@
 
 #include "arm_2d_helper_scene.h"
 #include "arm_2d_example_controls.h"
+#include "arm_2d_disp_adapter_0.h"
 
 #ifdef   __cplusplus
 extern "C" {
@@ -103,6 +104,11 @@ ARM_PRIVATE(
 #endif
 
 )
+#if __DISP0_CFG_USE_STATIC_LAYER_CACHE__
+ARM_PRIVATE(
+    disp_adapter0_layer_cache_t tPanelLayer;
+)
+#endif
     /* place your public member here */
     
 };
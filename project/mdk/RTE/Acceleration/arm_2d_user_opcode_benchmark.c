@@ -0,0 +1,104 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*============================ INCLUDES ======================================*/
+#define __ARM_2D_IMPL__
+
+#include <stdio.h>
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+#include "perf_counter.h"
+
+#include "arm_2d_user_opcode_benchmark.h"
+#include "__arm_2d_user_opcode_rgb565.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#endif
+
+/*============================ MACROS ========================================*/
+
+/* the spans of each length are blended this many times */
+#define __BENCHMARK_REPEAT          64
+
+/* the longest span, a row of the panel */
+#define __BENCHMARK_MAX_PIXELS      320
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+/* one more pixel for the unaligned spans */
+static uint16_t s_hwBuffer[__BENCHMARK_MAX_PIXELS + 1];
+
+/*============================ IMPLEMENTATION ================================*/
+
+void arm_2d_user_opcode_benchmark_rgb565_span(void)
+{
+    static const int16_t c_iLengths[] = {1, 2, 8, 32, 128, __BENCHMARK_MAX_PIXELS};
+
+    printf("\r\npixels,per_pixel_ticks,span_ticks\r\n");
+
+    for (uint_fast8_t n = 0; n < dimof(c_iLengths); n++) {
+        int32_t nCount = c_iLengths[n];
+
+        /* both aligned and unaligned spans, with opacities in 100 ~ 107 */
+        int64_t lStart = get_system_ticks();
+        for (int32_t r = 0; r < __BENCHMARK_REPEAT; r++) {
+            uint16_t *phwPixel = &s_hwBuffer[r & 1];
+            uint16_t hwColour = 0x1234;
+
+            for (int32_t i = 0; i < nCount; i++) {
+                __ARM_2D_PIXEL_BLENDING_OPA_RGB565( &hwColour,
+                                                    phwPixel++,
+                                                    (uint8_t)(100 + (r & 7)));
+            }
+        }
+        int64_t lPerPixel = get_system_ticks() - lStart;
+
+        lStart = get_system_ticks();
+        for (int32_t r = 0; r < __BENCHMARK_REPEAT; r++) {
+            __arm_2d_user_rgb565_fill_span_opa( &s_hwBuffer[r & 1],
+                                                nCount,
+                                                0x1234,
+                                                (uint8_t)(100 + (r & 7)));
+        }
+        int64_t lSpan = get_system_ticks() - lStart;
+
+        printf( "%d,%d,%d\r\n",
+                (int)nCount,
+                (int)(lPerPixel / __BENCHMARK_REPEAT),
+                (int)(lSpan / __BENCHMARK_REPEAT));
+    }
+}
+
+
+#ifdef   __cplusplus
+}
+#endif
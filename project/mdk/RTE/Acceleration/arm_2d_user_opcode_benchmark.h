@@ -0,0 +1,51 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __ARM_2D_USER_OPCODE_BENCHMARK_H__
+#define __ARM_2D_USER_OPCODE_BENCHMARK_H__
+
+/*============================ INCLUDES ======================================*/
+
+#include "arm_2d.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*!
+ * \brief measure the RGB565 span blending of the user opcodes against the
+ *        per-pixel blending of Arm-2D, and print a CSV table of the ticks
+ *        per span
+ * \note the ticks come from get_system_ticks() of perf_counter, i.e. the CPU
+ *       cycles on the target
+ */
+extern
+void arm_2d_user_opcode_benchmark_rgb565_span(void);
+
+
+#ifdef   __cplusplus
+}
+#endif
+
+
+#endif /* __ARM_2D_USER_OPCODE_BENCHMARK_H__ */
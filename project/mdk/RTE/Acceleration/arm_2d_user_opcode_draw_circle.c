@@ -21,10 +21,11 @@
 
 #include "arm_2d.h"
 #include "__arm_2d_impl.h"
-#include "__arm_2d_example_opcodes_common.h"
+#include "__arm_2d_user_opcode_common.h"
 
 #include "arm_2d_user_opcode_draw_circle.h"
 #include "arm_2d_helper.h"
+#include "__arm_2d_user_opcode_rgb565.h"
 
 
 #ifdef   __cplusplus
@@ -69,49 +70,163 @@ extern "C" {
 /*============================ TYPES =========================================*/
 /*============================ GLOBAL VARIABLES ==============================*/
 /*============================ PROTOTYPES ====================================*/
-extern
-void __arm_2d_impl_rgb565_user_draw_circle(
-                            arm_2d_user_draw_circle_descriptor_t *ptThis,
-                            uint16_t *__RESTRICT pwTarget,
-                            int16_t iTargetStride,
-                            arm_2d_region_t *__RESTRICT ptValidRegionOnVirtualScreen,
-                            arm_2d_region_t *ptTargetRegionOnVirtualScreen);
-
 /*============================ LOCAL VARIABLES ===============================*/
-/*============================ IMPLEMENTATION ================================*/
 
+/* sin() of 0 to 90 degrees in Q14 */
+static const int16_t c_iSinQ14[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
 
-/*
- * the Frontend API
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief the distance in Q8, i.e. floor(sqrt(wDistance2) * 256)
+ * \note beyond a distance of 255, the fraction loses one bit each time the
+ *       distance doubles, so the squared distance never overflows 32 bits
  */
+static uint32_t __arm_2d_user_circle_distance_q8(uint32_t wDistance2)
+{
+    uint_fast8_t chShift = 0;
+
+    while (chShift < 8 && wDistance2 >= (0x10000ul << (chShift * 2))) {
+        chShift++;
+    }
 
-ARM_NONNULL(2,4)
-arm_fsm_rt_t arm_2dp_rgb565_user_draw_circle(  
-                            arm_2d_user_draw_circle_descriptor_t *ptOP,
+    return __arm_2d_user_isqrt(wDistance2 << (16 - chShift * 2))
+        << chShift;
+}
+
+/*!
+ * \brief calculate the pivot and the draw region of a circle
+ * \retval false nothing to draw
+ */
+static bool __arm_2d_user_draw_circle_prepare(
+                            arm_2d_user_draw_circle_descriptor_t *ptThis,
                             const arm_2d_tile_t *ptTarget,
-                            const arm_2d_region_t *ptRegion,
-                            const arm_2d_user_draw_circle_api_params_t *ptParams,
-                            arm_2d_color_rgb565_t tColour,
-                            uint8_t chOpacity)
+                            const arm_2d_region_t *ptRegion)
 {
+    arm_2d_region_t tTargetRegion = {0};
+    if (NULL == ptRegion) {
+        tTargetRegion.tSize = ptTarget->tRegion.tSize;
+        ptRegion = &tTargetRegion;
+    }
 
-    assert(NULL != ptTarget);
-    assert(NULL != ptParams);
+    if (this.tParams.ptPivot) {
+        this.tPivot = *this.tParams.ptPivot;
+    } else {
+        this.tPivot.iX = ptRegion->tLocation.iX + (ptRegion->tSize.iWidth >> 1);
+        this.tPivot.iY = ptRegion->tLocation.iY + (ptRegion->tSize.iHeight >> 1);
+    }
+
+    this.tDrawRegion.tSize.iHeight = this.tParams.iRadius * 2 + 2;
+    this.tDrawRegion.tSize.iWidth = this.tDrawRegion.tSize.iHeight + 2;
 
-    ARM_2D_IMPL(arm_2d_user_draw_circle_descriptor_t, ptOP);
+    this.tDrawRegion.tLocation.iX = this.tPivot.iX - this.tParams.iRadius - 1;
+    this.tDrawRegion.tLocation.iY = this.tPivot.iY - this.tParams.iRadius - 1;
 
-    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
-        return arm_fsm_rt_on_going;
+    if (!arm_2d_region_intersect(ptRegion, &this.tDrawRegion, &this.tDrawRegion)) {
+        return false;
     }
 
-    OP_CORE.ptOp = &ARM_2D_OP_USER_DRAW_CIRCLE;
-    OPCODE.Target.ptTile = ptTarget;
-    OPCODE.Target.ptRegion = ptRegion;
+    OPCODE.Target.ptRegion = &this.tDrawRegion;
 
-    /* this is updated in prepare function */
-    this.tParams = *ptParams;
-    this.chOpacity = chOpacity;
-    this.tForeground.hwColour = tColour.tValue;
+    this.tPivot = arm_2d_get_absolute_location(ptTarget, this.tPivot, true );
+
+    return true;
+}
+
+/*!
+ * \brief sin() of an angle in degrees, Q14
+ */
+static int32_t __arm_2d_user_arc_sin_q14(int32_t nAngle)
+{
+    nAngle %= 360;
+    if (nAngle < 0) {
+        nAngle += 360;
+    }
+
+    if (nAngle <= 90) {
+        return c_iSinQ14[nAngle];
+    } else if (nAngle <= 180) {
+        return c_iSinQ14[180 - nAngle];
+    } else if (nAngle <= 270) {
+        return -c_iSinQ14[nAngle - 180];
+    }
+    return -c_iSinQ14[360 - nAngle];
+}
+
+/*!
+ * \brief prepare a side of the arc
+ * \param[in] nA the inner normal, Q14
+ * \param[in] nB the inner normal, Q14
+ */
+static void __arm_2d_user_arc_prepare_edge( arm_2d_user_arc_edge_t *ptEdge,
+                                            int32_t nA,
+                                            int32_t nB,
+                                            bool bAntiAlias)
+{
+    ptEdge->nA = nA;
+    ptEdge->nB = nB;
+    ptEdge->nXPerRow = 0;
+    ptEdge->nXHalfBand = 0;
+
+    if (0 != nA) {
+        /* where the rows meet the side, and the pixels within half a pixel */
+        ptEdge->nXPerRow = (int32_t)((int64_t)(-nB) * 65536 / nA);
+        if (bAntiAlias) {
+            ptEdge->nXHalfBand = (int32_t)(((int64_t)1 << 29) / ABS(nA));
+        }
+    }
+}
+
+/*!
+ * \brief prepare the sides, the pivot and the draw region of an arc
+ * \retval false nothing to draw
+ */
+static bool __arm_2d_user_draw_arc_prepare(
+                            arm_2d_user_draw_arc_descriptor_t *ptThis,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion)
+{
+    int32_t nSweep = (int32_t)this.tParams.iEndAngle - (int32_t)this.tParams.iStartAngle;
+    this.bIsRing = (nSweep >= 360);
+    if (!this.bIsRing) {
+        nSweep %= 360;
+        if (nSweep < 0) {
+            nSweep += 360;
+        }
+    }
+
+    if (0 == nSweep || this.tParams.iOuterRadius < 0) {
+        return false;
+    }
+
+    if (!this.bIsRing) {
+        int32_t nStartAngle = this.tParams.iStartAngle;
+        int32_t nEndAngle = nStartAngle + nSweep;
+
+        /* the inside is clockwise from the start side and anti-clockwise 
+         * from the end side, both sides are needed beyond 180 degrees 
+         */
+        __arm_2d_user_arc_prepare_edge( &this.tEdges[0],
+                                        -__arm_2d_user_arc_sin_q14(nStartAngle),
+                                        __arm_2d_user_arc_sin_q14(nStartAngle + 90),
+                                        this.tParams.bAntiAlias);
+        __arm_2d_user_arc_prepare_edge( &this.tEdges[1],
+                                        __arm_2d_user_arc_sin_q14(nEndAngle),
+                                        -__arm_2d_user_arc_sin_q14(nEndAngle + 90),
+                                        this.tParams.bAntiAlias);
+        this.bIsWide = (nSweep > 180);
+    }
 
     arm_2d_region_t tTargetRegion = {0};
     if (NULL == ptRegion) {
@@ -128,182 +243,216 @@ arm_fsm_rt_t arm_2dp_rgb565_user_draw_circle(
             this.tPivot.iY = ptRegion->tLocation.iY + (ptRegion->tSize.iHeight >> 1);
         }
 
-        this.tDrawRegion.tSize.iHeight = this.tParams.iRadius * 2 + 2;
-        this.tDrawRegion.tSize.iWidth = this.tDrawRegion.tSize.iHeight + 2;
+        this.tDrawRegion.tSize.iWidth = this.tParams.iOuterRadius * 2 + 3;
+        this.tDrawRegion.tSize.iHeight = this.tDrawRegion.tSize.iWidth;
 
-        this.tDrawRegion.tLocation.iX = this.tPivot.iX - this.tParams.iRadius - 1;
-        this.tDrawRegion.tLocation.iY = this.tPivot.iY - this.tParams.iRadius - 1;
+        this.tDrawRegion.tLocation.iX = this.tPivot.iX - this.tParams.iOuterRadius - 1;
+        this.tDrawRegion.tLocation.iY = this.tPivot.iY - this.tParams.iOuterRadius - 1;
 
         if (!arm_2d_region_intersect(ptRegion, &this.tDrawRegion, &this.tDrawRegion)) {
-            /* nothing to draw */
-            return __arm_2d_op_depose((arm_2d_op_core_t *)ptThis, arm_fsm_rt_cpl);
+            return false;
         }
 
         OPCODE.Target.ptRegion = &this.tDrawRegion;
 
         this.tPivot = arm_2d_get_absolute_location(ptTarget, this.tPivot, true );
     } while(0);
-    
-    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
-}
 
+    return true;
+}
 
-/*
- * The backend entry
+/*!
+ * \brief the coverage of a pixel of the arc, 0 to 255
+ * \param[in] nXOffset the x of the pixel relative to the pivot
+ * \param[in] nYOffset the y of the pixel relative to the pivot
  */
-arm_fsm_rt_t __arm_2d_rgb565_sw_user_draw_circle( __arm_2d_sub_task_t *ptTask)
+__STATIC_FORCEINLINE
+uint_fast8_t __arm_2d_user_arc_coverage(arm_2d_user_draw_arc_descriptor_t *ptThis,
+                                        int32_t nXOffset,
+                                        int32_t nYOffset,
+                                        bool bAntiAlias)
 {
-    ARM_2D_IMPL(arm_2d_user_draw_circle_descriptor_t, ptTask->ptOP);
-
-    assert(ARM_2D_COLOUR_SZ_16BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
-
-    arm_2d_region_t tTargetRegion = {0};
-    
-    if (NULL == ((arm_2d_op_t *)ptThis)->Target.ptRegion) {
-        tTargetRegion.tSize = ((arm_2d_op_t *)ptThis)->Target.ptTile->tRegion.tSize;
+    int32_t nInner = this.tParams.iInnerRadius;
+    int32_t nOuter = this.tParams.iOuterRadius;
+    uint32_t wDistance2 = (uint32_t)(nXOffset * nXOffset + nYOffset * nYOffset);
+    int32_t nCoverage = 255;
+
+    if (!bAntiAlias) {
+        if (    wDistance2 > (uint32_t)(nOuter * nOuter) 
+            ||  wDistance2 < (uint32_t)(nInner * nInner)) {
+            return 0;
+        }
     } else {
-        tTargetRegion = *(((arm_2d_op_t *)ptThis)->Target.ptRegion);
+        if (wDistance2 >= (uint32_t)((nOuter + 1) * (nOuter + 1))) {
+            return 0;
+        } else if (wDistance2 > (uint32_t)(nOuter * nOuter)) {
+            uint32_t wFraction = (__arm_2d_user_circle_distance_q8(wDistance2) - ((uint32_t)nOuter << 8)) & 0xFF;
+            nCoverage = 0xFF - wFraction;
+        }
+
+        if (wDistance2 < (uint32_t)(nInner * nInner)) {
+            if (wDistance2 <= (uint32_t)((nInner - 1) * (nInner - 1))) {
+                return 0;
+            }
+            int32_t nFraction = __arm_2d_user_circle_distance_q8(wDistance2) - ((nInner - 1) << 8);
+            nCoverage = MIN(nCoverage, MIN(nFraction, 255));
+        }
     }
 
-    tTargetRegion.tLocation 
-        = arm_2d_get_absolute_location( ((arm_2d_op_t *)ptThis)->Target.ptTile,
-                                        tTargetRegion.tLocation,
-                                        true);
+    if (this.bIsRing) {
+        return nCoverage;
+    }
 
-    __arm_2d_impl_rgb565_user_draw_circle(ptThis,
-                                        ptTask->Param.tTileProcess.pBuffer,
-                                        ptTask->Param.tTileProcess.iStride,
-                                        &(ptTask->Param.tTileProcess.tValidRegionInVirtualScreen),
-                                        &tTargetRegion);
+    int32_t nSide[2];
+    for (int_fast8_t n = 0; n < 2; n++) {
+        int32_t nDistance = this.tEdges[n].nA * nXOffset + this.tEdges[n].nB * nYOffset;
 
+        if (bAntiAlias) {
+            nSide[n] = MAX(0, MIN((nDistance + (1 << 13)) >> 6, 255));
+        } else {
+            nSide[n] = (nDistance >= 0) ? 255 : 0;
+        }
+    }
 
-    return arm_fsm_rt_cpl;
+    if (this.bIsWide) {
+        return MIN(nCoverage, MAX(nSide[0], nSide[1]));
+    }
+    return MIN(nCoverage, MIN(nSide[0], nSide[1]));
 }
 
+/*!
+ * \brief whether a pixel is inside of the sides of the arc
+ */
+static bool __arm_2d_user_arc_is_inside_sides(
+                                    arm_2d_user_draw_arc_descriptor_t *ptThis,
+                                    int32_t nXOffset,
+                                    int32_t nYOffset)
+{
+    bool bInside[2];
+    for (int_fast8_t n = 0; n < 2; n++) {
+        bInside[n] = (this.tEdges[n].nA * nXOffset + this.tEdges[n].nB * nYOffset) >= 0;
+    }
+
+    if (this.bIsWide) {
+        return bInside[0] || bInside[1];
+    }
+    return bInside[0] && bInside[1];
+}
 
-/* default low level implementation */
-__WEAK
-void __arm_2d_impl_rgb565_user_draw_circle(
-                                    arm_2d_user_draw_circle_descriptor_t *ptThis,
-                                    uint16_t *__RESTRICT phwTargetBase,
-                                    int16_t iTargetStride,
-                                    arm_2d_region_t *__RESTRICT ptValidRegionOnVirtualScreen,
-                                    arm_2d_region_t *ptTargetRegionOnVirtualScreen)
+/*!
+ * \brief calculate the union of the bounding boxes and the origin of a batch,
+ *        and sort the visible circles by their top rows
+ * \retval false nothing to draw
+ */
+static bool __arm_2d_user_draw_circles_prepare(
+                            arm_2d_user_draw_circles_descriptor_t *ptThis,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion)
 {
-    uint8_t chOpacity = this.chOpacity;
-    uint16_t *__RESTRICT phwTarget = phwTargetBase;
-    uint16_t hwColour = this.tForeground.hwColour;
-
-    /* calculate the offset between the target region and the valid region */
-    arm_2d_location_t tOffset = {
-        .iX = ptValidRegionOnVirtualScreen->tLocation.iX - ptTargetRegionOnVirtualScreen->tLocation.iX,
-        .iY = ptValidRegionOnVirtualScreen->tLocation.iY - ptTargetRegionOnVirtualScreen->tLocation.iY,
-    };
-    ARM_2D_UNUSED(tOffset);
-    /*
-         Virtual Screen
-         +--------------------------------------------------------------+
-         |                                                              |
-         |        Target Region                                         |
-         |       +-------------------------------------------+          |
-         |       |                                           |          |
-         |       |                  +-------------------+    |          |
-         |       |                  | Valid Region      |    |          |
-         |       |                  |                   |    |          |
-         |       |                  +-------------------+    |          |     
-         |       |                                           |          |
-         |       |                                           |          |     
-         |       +-------------------------------------------+          |
-         +--------------------------------------------------------------+     
-     
-         NOTE: 1. Both the Target Region and the Valid Region are relative
-                  regions of the virtual Screen in this function.
-               2. The Valid region is always inside the Target Region.
-               3. tOffset is the relative location between the Valid Region
-                  and the Target Region.
-               4. The Valid Region marks the location and size of the current
-                  working buffer on the virtual screen. Only the valid region
-                  contains a valid buffer.
-     */
-
-    int_fast16_t iWidth = ptValidRegionOnVirtualScreen->tSize.iWidth + ptValidRegionOnVirtualScreen->tLocation.iX;
-    int_fast16_t iHeight = ptValidRegionOnVirtualScreen->tSize.iHeight + ptValidRegionOnVirtualScreen->tLocation.iY;
-
-    uint32_t wRadius2 = (uint32_t)this.tParams.iRadius * (uint32_t)this.tParams.iRadius;
-    uint32_t wRadiusBorder2 = (uint32_t)(this.tParams.iRadius + 1) * (uint32_t)(this.tParams.iRadius + 1);
-    q16_t q16Radius = reinterpret_q16_s16(this.tParams.iRadius);
-
-    for (int_fast16_t iY = ptValidRegionOnVirtualScreen->tLocation.iY; iY < iHeight; iY++) {
-
-        uint16_t *phwTargetLine = phwTarget;
-        int16_t iYOffset = iY - this.tPivot.iY;
-        iYOffset = ABS(iYOffset);
-
-        for (int_fast16_t iX = ptValidRegionOnVirtualScreen->tLocation.iX; iX < iWidth; iX++) {
-
-            int16_t iXOffset = iX - this.tPivot.iX;
-            iXOffset = ABS(iXOffset);
-            
-            /* calculate the distance */
-            uint32_t wDistance2 = (uint32_t)iXOffset * (uint32_t)iXOffset + (uint32_t)iYOffset * (uint32_t)iYOffset;
-            
-            if (wDistance2 >= wRadiusBorder2) {
-                phwTargetLine++;
-                continue;
-            } else if (wDistance2 <= wRadius2) {
-                /* fill colour with opacity */
-                __ARM_2D_PIXEL_BLENDING_OPA_RGB565(&hwColour, phwTargetLine++, chOpacity);
-                continue;
-            } else if (!this.tParams.bAntiAlias) {
-                phwTargetLine++;
-                continue;
-            }
+    arm_2d_region_t tTargetRegion = {0};
+    if (NULL == ptRegion) {
+        tTargetRegion.tSize = ptTarget->tRegion.tSize;
+        ptRegion = &tTargetRegion;
+    }
+
+    const arm_2d_user_circle_t *ptCircles = this.tParams.ptCircles;
+
+    this.hwOrderCount = 0;
 
-            /* anti alias */
-            float fDistance;
-            arm_sqrt_f32((float)wDistance2, &fDistance);
-            q16_t q16Fraction = reinterpret_q16_f32(fDistance);
+    for (uint_fast16_t n = 0; n < this.tParams.hwCount; n++) {
+        const arm_2d_user_circle_t *ptCircle = &ptCircles[n];
+
+        if (0 == ptCircle->chOpacity || ptCircle->iRadius < 0) {
+            continue;
+        }
+
+        arm_2d_region_t tBox = {
+            .tLocation = {
+                .iX = ptCircle->tPivot.iX - ptCircle->iRadius - 1,
+                .iY = ptCircle->tPivot.iY - ptCircle->iRadius - 1,
+            },
+            .tSize = {
+                .iWidth = ptCircle->iRadius * 2 + 3,
+                .iHeight = ptCircle->iRadius * 2 + 3,
+            },
+        };
+
+        if (!arm_2d_region_intersect(ptRegion, &tBox, &tBox)) {
+            /* the circle is outside of the region */
+            continue;
+        }
+
+        if (0 == this.hwOrderCount) {
+            this.tDrawRegion = tBox;
+        } else {
+            arm_2d_region_t tUnion = this.tDrawRegion;
+            arm_2d_region_get_minimal_enclosure(&tUnion, &tBox, &this.tDrawRegion);
+        }
 
-            /* get the residual */
-            q16Fraction -= q16Radius;
+        /* insertion sort by the top rows: the circles of an animation move a 
+         * little per frame, so it is nearly linear when they are kept in order
+         */
+        int32_t nTop = ptCircle->tPivot.iY - ptCircle->iRadius;
+        uint_fast16_t m = this.hwOrderCount++;
 
-            uint16_t hwOpacity = (q16Fraction & 0xFF00) >> 8;
-            uint8_t chPointOpacity = arm_2d_helper_alpha_mix(0xFF - hwOpacity, chOpacity);
-            
-            __ARM_2D_PIXEL_BLENDING_OPA_RGB565(&hwColour, phwTargetLine++, chPointOpacity);
+        while (m > 0) {
+            const arm_2d_user_circle_t *ptPrevious = &ptCircles[this.hwOrder[m - 1]];
+            if (ptPrevious->tPivot.iY - ptPrevious->iRadius <= nTop) {
+                break;
+            }
+            this.hwOrder[m] = this.hwOrder[m - 1];
+            m--;
         }
+        this.hwOrder[m] = (uint16_t)n;
+    }
 
-        phwTarget += iTargetStride;
+    if (0 == this.hwOrderCount) {
+        return false;
     }
 
+    OPCODE.Target.ptRegion = &this.tDrawRegion;
+
+    this.tOrigin = arm_2d_get_absolute_location(ptTarget,
+                                                (arm_2d_location_t){0},
+                                                true);
+
+    return true;
 }
 
 /*
- * OPCODE Low Level Implementation Entries
+ * The circle, the batched circles and the arc opcodes of each colour format
  */
-__WEAK
-def_low_lv_io(  __ARM_2D_IO_USER_DRAW_CIRCLE_RGB565,
-                __arm_2d_rgb565_sw_user_draw_circle);      /* Default SW Implementation */
 
-/*
- * OPCODE
+#define __API_COLOUR                    gray8
+#define __API_COLOUR_UPPERCASE          GRAY8
+#define __API_INT_TYPE                  uint8_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_8BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_GRAY8
+
+#include "__arm_2d_user_opcode_draw_circle.inc"
+
+#define __API_COLOUR                    rgb565
+#define __API_COLOUR_UPPERCASE          RGB565
+#define __API_INT_TYPE                  uint16_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_16BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_RGB565
+
+/* NOTE: the RGB565 spans round the opacity to 1/32: below 4 nothing is drawn
+ *       and 252 or above is opaque. So the interior of an RGB565 circle may
+ *       differ from gray8 and cccn888 by 1 LSB, and from its anti-alias edge,
+ *       which is blended per pixel with the 8-bit opacity.
  */
-const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLE = {
-    .Info = {
-        .Colour = {
-            .chScheme   = ARM_2D_COLOUR_RGB565,
-        },
-        .Param = {
-            .bHasTarget     = true,
-        },
-        .chOpIndex      = __ARM_2D_OP_IDX_USER_DRAW_CIRCLE,
-        
-        .LowLevelIO = {
-            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_USER_DRAW_CIRCLE_RGB565),
-        },
-    },
-};
+#define __API_SPAN_BLENDING_OPA         __arm_2d_user_rgb565_fill_span_opa
+
+#include "__arm_2d_user_opcode_draw_circle.inc"
+
+#define __API_COLOUR                    cccn888
+#define __API_COLOUR_UPPERCASE          CCCN888
+#define __API_INT_TYPE                  uint32_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_32BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_CCCN888
 
+#include "__arm_2d_user_opcode_draw_circle.inc"
 
 
 #ifdef   __cplusplus
@@ -39,6 +39,17 @@ extern "C" {
 
 
 /*============================ MACROS ========================================*/
+
+/* the capacity of arm_2d_user_draw_circles_descriptor_t */
+#ifndef ARM_2D_USER_DRAW_CIRCLES_MAX_COUNT
+#   define ARM_2D_USER_DRAW_CIRCLES_MAX_COUNT           32
+#endif
+
+/* the RGB565 ops keep their original names */
+#define ARM_2D_OP_USER_DRAW_CIRCLE      ARM_2D_OP_USER_DRAW_CIRCLE_RGB565
+#define ARM_2D_OP_USER_DRAW_CIRCLES     ARM_2D_OP_USER_DRAW_CIRCLES_RGB565
+#define ARM_2D_OP_USER_DRAW_ARC         ARM_2D_OP_USER_DRAW_ARC_RGB565
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
 
@@ -60,20 +71,144 @@ typedef struct arm_2d_user_draw_circle_descriptor_t {
     arm_2d_region_t tDrawRegion;
 
     uint8_t chOpacity;
-    COLOUR_TYPE_T tForeground;
+    uint32_t wColour;                   /* in the colour format of the op */
 
 }arm_2d_user_draw_circle_descriptor_t;
 
+/*!
+ * \brief a circle in a batch, the pivot is a location in the target tile
+ */
+typedef struct arm_2d_user_circle_t {
+    arm_2d_location_t tPivot;
+    int16_t iRadius;
+    uint32_t wColour;                   /* in the colour format of the op */
+    uint8_t chOpacity;
+} arm_2d_user_circle_t;
+
+typedef struct arm_2d_user_draw_circles_api_params_t {
+
+    /* NOTE: the array is referenced, keep it alive until the op completes */
+    const arm_2d_user_circle_t *ptCircles;
+    uint16_t hwCount;                   /* no more than ARM_2D_USER_DRAW_CIRCLES_MAX_COUNT */
+    bool bAntiAlias;
+
+} arm_2d_user_draw_circles_api_params_t;
+
+
+typedef struct arm_2d_user_draw_circles_descriptor_t {
+    implement(arm_2d_op_t);      /* inherit from base class arm_2d_op_t*/
+
+    arm_2d_user_draw_circles_api_params_t tParams;
+    arm_2d_location_t tOrigin;          /* the absolute location of the target */
+    arm_2d_region_t tDrawRegion;
+
+    /* the indexes of the visible circles in the order of their top rows */
+    uint16_t hwOrder[ARM_2D_USER_DRAW_CIRCLES_MAX_COUNT];
+    uint16_t hwOrderCount;
+
+}arm_2d_user_draw_circles_descriptor_t;
+
+
+typedef struct arm_2d_user_draw_arc_api_params_t {
+
+    arm_2d_location_t *ptPivot;         /* NULL means the centre of the region */
+    int16_t iInnerRadius;               /* 0 for a pie */
+    int16_t iOuterRadius;
+
+    /* in degrees, clockwise from 3 o'clock, the arc goes clockwise from the
+     * start to the end, and a sweep of 360 or more draws the whole ring
+     */
+    int16_t iStartAngle;
+    int16_t iEndAngle;
+    bool bAntiAlias;
+
+} arm_2d_user_draw_arc_api_params_t;
+
+/*!
+ * \brief a side of the arc as a half plane through the pivot, a * dX + b * dY
+ *        >= 0 is inside, where dX and dY are relative to the pivot
+ */
+typedef struct arm_2d_user_arc_edge_t {
+    int32_t nA;                         /* the unit inner normal, Q14 */
+    int32_t nB;
+
+    /* for the spans, Q16 */
+    int32_t nXPerRow;                   /* the X shift of the side per row */
+    int32_t nXHalfBand;                 /* half of the anti-alias band in X */
+} arm_2d_user_arc_edge_t;
+
+
+typedef struct arm_2d_user_draw_arc_descriptor_t {
+    implement(arm_2d_op_t);      /* inherit from base class arm_2d_op_t*/
+
+    arm_2d_user_draw_arc_api_params_t tParams;
+    arm_2d_location_t tPivot;
+    arm_2d_region_t tDrawRegion;
+
+    arm_2d_user_arc_edge_t tEdges[2];   /* the start side and the end side */
+    bool bIsRing;                       /* no sides at all */
+    bool bIsWide;                       /* sweeps more than 180 degrees */
+
+    uint8_t chOpacity;
+    uint32_t wColour;                   /* in the colour format of the op */
+
+}arm_2d_user_draw_arc_descriptor_t;
+
 
 /*============================ GLOBAL VARIABLES ==============================*/
 
 extern
-const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLE;
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLE_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLE_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLE_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLES_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLES_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_CIRCLES_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_ARC_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_ARC_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_ARC_CCCN888;
 
 /*============================ PROTOTYPES ====================================*/
 /*============================ LOCAL VARIABLES ===============================*/
 /*============================ IMPLEMENTATION ================================*/
 
+/*!
+ * \brief draw a circle, the gray8, rgb565 and cccn888 versions are generated
+ *        from the same template
+ * \param[in] ptOP the control block, NULL means using the default one
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the clipping region in the target tile
+ * \param[in] ptParams the pivot, the radius and the anti-alias option
+ * \param[in] tColour the colour of the circle
+ * \param[in] chOpacity the opacity of the circle
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_draw_circle(
+                    arm_2d_user_draw_circle_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_circle_api_params_t *ptParams,
+                    arm_2d_color_gray8_t tColour,
+                    uint8_t chOpacity);
+
 extern
 ARM_NONNULL(2,4)
 arm_fsm_rt_t arm_2dp_rgb565_user_draw_circle(  
@@ -84,6 +219,98 @@ arm_fsm_rt_t arm_2dp_rgb565_user_draw_circle(
                     arm_2d_color_rgb565_t tColour,
                     uint8_t chOpacity);
 
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_draw_circle(
+                    arm_2d_user_draw_circle_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_circle_api_params_t *ptParams,
+                    arm_2d_color_cccn888_t tColour,
+                    uint8_t chOpacity);
+
+/*!
+ * \brief draw a batch of circles in one pass, each scanline of the target is
+ *        visited once for all circles, the gray8, rgb565 and cccn888 versions
+ *        are generated from the same template
+ * \note the wColour of every circle is in the colour format of the function
+ * \note overlapping circles are blended in the order of the array, the same
+ *       as drawing them one by one
+ * \param[in] ptOP the control block, NULL means using the default one
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the clipping region in the target tile
+ * \param[in] ptParams the circle array, no more than 
+ *            ARM_2D_USER_DRAW_CIRCLES_MAX_COUNT circles, and the drawing 
+ *            options
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_draw_circles(
+                    arm_2d_user_draw_circles_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_circles_api_params_t *ptParams);
+
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_rgb565_user_draw_circles(
+                    arm_2d_user_draw_circles_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_circles_api_params_t *ptParams);
+
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_draw_circles(
+                    arm_2d_user_draw_circles_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_circles_api_params_t *ptParams);
+
+/*!
+ * \brief draw an arc of a ring, or a pie when the inner radius is 0, the
+ *        gray8, rgb565 and cccn888 versions are generated from the same
+ *        template
+ * \param[in] ptOP the control block, NULL means using the default one
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the clipping region in the target tile
+ * \param[in] ptParams the pivot, the radii, the angles and the anti-alias
+ *            option
+ * \param[in] tColour the colour of the arc
+ * \param[in] chOpacity the opacity of the arc
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_draw_arc(
+                    arm_2d_user_draw_arc_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_arc_api_params_t *ptParams,
+                    arm_2d_color_gray8_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_rgb565_user_draw_arc(
+                    arm_2d_user_draw_arc_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_arc_api_params_t *ptParams,
+                    arm_2d_color_rgb565_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_draw_arc(
+                    arm_2d_user_draw_arc_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_arc_api_params_t *ptParams,
+                    arm_2d_color_cccn888_t tColour,
+                    uint8_t chOpacity);
+
 
 #if defined(__clang__)
 #   pragma clang diagnostic pop
@@ -40,6 +40,17 @@ extern "C" {
 
 
 /*============================ MACROS ========================================*/
+
+/* the capacity of arm_2d_user_draw_lines_descriptor_t */
+#ifndef ARM_2D_USER_DRAW_LINES_MAX_SEGMENTS
+#   define ARM_2D_USER_DRAW_LINES_MAX_SEGMENTS          16
+#endif
+
+/* the RGB565 ops keep their original names */
+#define ARM_2D_OP_USER_DRAW_LINE            ARM_2D_OP_USER_DRAW_LINE_RGB565
+#define ARM_2D_OP_USER_DRAW_LINES           ARM_2D_OP_USER_DRAW_LINES_RGB565
+#define ARM_2D_OP_USER_DRAW_THICK_LINE      ARM_2D_OP_USER_DRAW_THICK_LINE_RGB565
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
 
@@ -49,6 +60,7 @@ typedef struct arm_2d_user_draw_line_api_params_t {
     
     arm_2d_location_t tStart;
     arm_2d_location_t tEnd;
+    bool bNoAntiAlias;                  /* false, i.e. anti-aliased, by default */
 
 } arm_2d_user_draw_line_api_params_t;
 
@@ -73,20 +85,134 @@ typedef struct arm_2d_user_draw_line_descriptor_t {
 
     uint8_t chOpacity;
     bool bUseYAdvance;
-    uint16_t hwColour;
+    union {
+        uint32_t wColour;               /* in the colour format of the op */
+        uint16_t hwColour;              /* the RGB565 colour, the original name */
+    };
 
 }arm_2d_user_draw_line_descriptor_t;
 
 
+typedef struct arm_2d_user_draw_lines_api_params_t {
+
+    const arm_2d_user_draw_line_api_params_t *ptLines;
+    uint16_t hwCount;
+
+} arm_2d_user_draw_lines_api_params_t;
+
+/*!
+ * \brief a prepared line segment, the coordinates are in the target tile
+ */
+typedef struct arm_2d_user_line_segment_t {
+    arm_2d_location_t tStart;           /* the reference of the steps */
+    arm_2d_location_t tEnd;
+    q16_t q16Step;                      /* dX per row or dY per column */
+    bool bUseYAdvance;
+    bool bAntiAlias;
+} arm_2d_user_line_segment_t;
+
+
+typedef struct arm_2d_user_draw_lines_descriptor_t {
+    implement(arm_2d_op_t);      /* inherit from base class arm_2d_op_t*/
+
+    /* prepared on the first PFB of a frame and reused by the rest */
+    arm_2d_user_line_segment_t tSegments[ARM_2D_USER_DRAW_LINES_MAX_SEGMENTS];
+    uint16_t hwCount;
+    arm_2d_region_t tDrawRegion;
+
+    uint8_t chOpacity;
+    uint32_t wColour;                   /* in the colour format of the op */
+
+}arm_2d_user_draw_lines_descriptor_t;
+
+
+typedef enum {
+    ARM_2D_USER_LINE_CAP_BUTT = 0,      /* ends at the end points */
+    ARM_2D_USER_LINE_CAP_SQUARE,        /* extends half of the width */
+    ARM_2D_USER_LINE_CAP_ROUND,
+} arm_2d_user_line_cap_t;
+
+typedef struct arm_2d_user_draw_thick_line_api_params_t {
+
+    arm_2d_location_t tStart;
+    arm_2d_location_t tEnd;
+    uint8_t chWidth;                    /* in pixels */
+    uint8_t chCap;                      /* see arm_2d_user_line_cap_t */
+    bool bNoAntiAlias;                  /* false, i.e. anti-aliased, by default */
+
+} arm_2d_user_draw_thick_line_api_params_t;
+
+
+typedef struct arm_2d_user_draw_thick_line_descriptor_t {
+    implement(arm_2d_op_t);      /* inherit from base class arm_2d_op_t*/
+
+    arm_2d_user_draw_thick_line_api_params_t tParams;
+    arm_2d_region_t tDrawRegion;
+    arm_2d_location_t tStart;           /* the absolute location */
+
+    /* the edge functions, Q14 */
+    int32_t nUX;                        /* the unit vector of the direction */
+    int32_t nUY;
+    int32_t nLength;
+    int32_t nHalfWidth;                 /* half of the width plus half a pixel */
+    int32_t nCapLimit;                  /* the cap extension plus half a pixel */
+
+    /* the bounding parallelogram relative to the start point, Q8 */
+    struct {
+        int32_t nX;
+        int32_t nY;
+    } tCorners[4];
+    int32_t nInvSlope[4];               /* dX/dY of each edge, Q16, INT32_MIN for flat */
+
+    uint8_t chOpacity;
+    uint32_t wColour;                   /* in the colour format of the op */
+
+}arm_2d_user_draw_thick_line_descriptor_t;
+
+
 /*============================ GLOBAL VARIABLES ==============================*/
 
 extern
-const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_LINE;
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_LINE_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_LINE_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_LINE_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_LINES_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_LINES_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_LINES_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_THICK_LINE_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_THICK_LINE_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_DRAW_THICK_LINE_CCCN888;
 
 /*============================ PROTOTYPES ====================================*/
 /*============================ LOCAL VARIABLES ===============================*/
 /*============================ IMPLEMENTATION ================================*/
 
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_draw_line(
+                    arm_2d_user_draw_line_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_line_api_params_t *ptParams,
+                    arm_2d_color_gray8_t tColour,
+                    uint8_t chOpacity);
+
 extern
 ARM_NONNULL(2,4)
 arm_fsm_rt_t arm_2dp_rgb565_user_draw_line(  
@@ -97,6 +223,100 @@ arm_fsm_rt_t arm_2dp_rgb565_user_draw_line(
                     arm_2d_color_rgb565_t tColour,
                     uint8_t chOpacity);
 
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_draw_line(
+                    arm_2d_user_draw_line_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_line_api_params_t *ptParams,
+                    arm_2d_color_cccn888_t tColour,
+                    uint8_t chOpacity);
+
+/*!
+ * \brief draw a list of lines with one op
+ * \note the lines are prepared on the first PFB of a frame, the following
+ *       PFBs of the same frame reuse the prepared slopes and ignore ptParams
+ * \param[in] ptOP the control block, it keeps the prepared lines and cannot
+ *            be NULL
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the clipping region in the target tile
+ * \param[in] ptParams the lines, no more than ARM_2D_USER_DRAW_LINES_MAX_SEGMENTS,
+ *            each line has its own bNoAntiAlias
+ * \param[in] tColour the colour of the lines
+ * \param[in] chOpacity the opacity of the lines
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_draw_lines(
+                    arm_2d_user_draw_lines_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_lines_api_params_t *ptParams,
+                    arm_2d_color_gray8_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_rgb565_user_draw_lines(
+                    arm_2d_user_draw_lines_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_lines_api_params_t *ptParams,
+                    arm_2d_color_rgb565_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_draw_lines(
+                    arm_2d_user_draw_lines_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_lines_api_params_t *ptParams,
+                    arm_2d_color_cccn888_t tColour,
+                    uint8_t chOpacity);
+
+/*!
+ * \brief draw a line of any width with the given caps, anti-aliased or not
+ * \param[in] ptOP the control block, NULL means using the default one
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the clipping region in the target tile
+ * \param[in] ptParams the end points, the width and the caps
+ * \param[in] tColour the colour of the line
+ * \param[in] chOpacity the opacity of the line
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_draw_thick_line(
+                    arm_2d_user_draw_thick_line_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_thick_line_api_params_t *ptParams,
+                    arm_2d_color_gray8_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_rgb565_user_draw_thick_line(
+                    arm_2d_user_draw_thick_line_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_thick_line_api_params_t *ptParams,
+                    arm_2d_color_rgb565_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_draw_thick_line(
+                    arm_2d_user_draw_thick_line_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_draw_thick_line_api_params_t *ptParams,
+                    arm_2d_color_cccn888_t tColour,
+                    uint8_t chOpacity);
+
 
 #if defined(__clang__)
 #   pragma clang diagnostic pop
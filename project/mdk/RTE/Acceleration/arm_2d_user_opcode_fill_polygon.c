@@ -0,0 +1,319 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*============================ INCLUDES ======================================*/
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+#include "__arm_2d_user_opcode_common.h"
+
+#include "arm_2d_user_opcode_fill_polygon.h"
+#include "arm_2d_helper.h"
+#include "__arm_2d_user_opcode_rgb565.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-float-conversion"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wswitch-enum"
+#   pragma clang diagnostic ignored "-Wswitch"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#elif defined(__IS_COMPILER_GCC__)
+#   pragma GCC diagnostic ignored "-Wdiscarded-qualifiers"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#endif
+
+/*============================ MACROS ========================================*/
+#undef OP_CORE
+#define OP_CORE this.use_as__arm_2d_op_t.use_as__arm_2d_op_core_t
+#undef OPCODE
+#define OPCODE this.use_as__arm_2d_op_t
+
+/* half a pixel in Q14 */
+#define __HALF_PIXEL_Q14        (1 << 13)
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief check whether the closed vertex list is a convex polygon
+ * \note all turns between neighbouring edges, i.e. the signs of their cross
+ *       products, must be the same, no edge may fold back onto the previous
+ *       one, and the edges must go round only once, i.e. the horizontal
+ *       direction changes no more than twice
+ */
+static bool __arm_2d_user_polygon_is_convex(const arm_2d_location_t *ptVertices,
+                                            uint_fast8_t chCount)
+{
+    int32_t nTurn = 0;
+    int32_t nFirstDX = 0;
+    int32_t nLastDX = 0;
+    uint_fast8_t chFlips = 0;
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        arm_2d_location_t tA = ptVertices[n];
+        arm_2d_location_t tB = ptVertices[(n + 1) % chCount];
+        arm_2d_location_t tC = ptVertices[(n + 2) % chCount];
+
+        int32_t nDX1 = tB.iX - tA.iX;
+        int32_t nDY1 = tB.iY - tA.iY;
+        int32_t nDX2 = tC.iX - tB.iX;
+        int32_t nDY2 = tC.iY - tB.iY;
+
+        int64_t lCross = (int64_t)nDX1 * nDY2 - (int64_t)nDY1 * nDX2;
+
+        if (0 == lCross) {
+            if ((int64_t)nDX1 * nDX2 + (int64_t)nDY1 * nDY2 < 0) {
+                /* folds back */
+                return false;
+            }
+        } else if (0 == nTurn) {
+            nTurn = (lCross > 0) ? 1 : -1;
+        } else if ((lCross > 0) != (nTurn > 0)) {
+            return false;
+        }
+
+        if (0 != nDX1) {
+            if (0 == nFirstDX) {
+                nFirstDX = nDX1;
+            } else if ((nDX1 > 0) != (nLastDX > 0)) {
+                chFlips++;
+            }
+            nLastDX = nDX1;
+        }
+    }
+
+    /* the change between the last and the first edge */
+    if ((nFirstDX > 0) != (nLastDX > 0)) {
+        chFlips++;
+    }
+
+    return chFlips <= 2;
+}
+
+/*!
+ * \brief prepare the half plane of the edge from tFrom to tTo
+ * \param[in] tFrom the start of the edge relative to the first vertex
+ * \param[in] tTo the end of the edge relative to the first vertex
+ * \param[in] nWinding 1 for clockwise on the screen, -1 for anti-clockwise
+ */
+static void __arm_2d_user_polygon_prepare_edge( arm_2d_user_polygon_edge_t *ptEdge,
+                                                arm_2d_location_t tFrom,
+                                                arm_2d_location_t tTo,
+                                                int32_t nWinding,
+                                                bool bAntiAlias)
+{
+    int32_t nDeltaX = tTo.iX - tFrom.iX;
+    int32_t nDeltaY = tTo.iY - tFrom.iY;
+
+    /* the length, keep as many fraction bits as 32bit allows */
+    uint32_t wLength2 = (uint32_t)nDeltaX * (uint32_t)nDeltaX
+                      + (uint32_t)nDeltaY * (uint32_t)nDeltaY;
+    int32_t nFractionBits = 14;
+    while (nFractionBits > 0 && (wLength2 >> (32 - nFractionBits * 2)) != 0) {
+        nFractionBits--;
+    }
+    int64_t lLength = __arm_2d_user_isqrt(wLength2 << (nFractionBits * 2));
+
+    /* the inner normal: the edge direction turned by 90 degrees */
+    int64_t lScale = (int64_t)1 << (14 + nFractionBits);
+    ptEdge->nA = (int32_t)((int64_t)(-nDeltaY * nWinding) * lScale / lLength);
+    ptEdge->nB = (int32_t)((int64_t)(nDeltaX * nWinding) * lScale / lLength);
+    ptEdge->nC = -(ptEdge->nA * tFrom.iX + ptEdge->nB * tFrom.iY);
+
+    /* where a row meets the lines parallel to the edge */
+    if (0 != ptEdge->nA) {
+        int32_t nOuter = bAntiAlias ? -__HALF_PIXEL_Q14 : 0;
+
+        ptEdge->lXPerRow = (int64_t)(-ptEdge->nB) * 65536 / ptEdge->nA;
+        ptEdge->lXOuter = (int64_t)(nOuter - ptEdge->nC) * 65536 / ptEdge->nA;
+        ptEdge->lXInner = (int64_t)(__HALF_PIXEL_Q14 - ptEdge->nC) * 65536 / ptEdge->nA;
+    }
+}
+
+static
+arm_2d_err_t __arm_2d_user_fill_polygon_prepare(
+                            arm_2d_user_fill_polygon_descriptor_t *ptThis,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion,
+                            const arm_2d_user_fill_polygon_api_params_t *ptParams)
+{
+    assert(NULL != ptParams->ptVertices);
+    assert(ptParams->chCount <= ARM_2D_USER_FILL_POLYGON_MAX_VERTICES);
+
+    if (ptParams->chCount > ARM_2D_USER_FILL_POLYGON_MAX_VERTICES) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    /* drop the repeated vertices, they make edges without a direction */
+    arm_2d_location_t tVertices[ARM_2D_USER_FILL_POLYGON_MAX_VERTICES];
+    uint_fast8_t chCount = 0;
+
+    for (uint_fast8_t n = 0; n < ptParams->chCount; n++) {
+        arm_2d_location_t tVertex = ptParams->ptVertices[n];
+
+        if (chCount > 0
+        &&  tVertex.iX == tVertices[chCount - 1].iX
+        &&  tVertex.iY == tVertices[chCount - 1].iY) {
+            continue;
+        }
+        tVertices[chCount++] = tVertex;
+    }
+    while (chCount > 1
+        && tVertices[chCount - 1].iX == tVertices[0].iX
+        && tVertices[chCount - 1].iY == tVertices[0].iY) {
+        chCount--;
+    }
+
+    this.chCount = 0;
+    this.bAntiAlias = ptParams->bAntiAlias;
+
+    /* twice of the signed area tells the winding */
+    int32_t nArea2 = 0;
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        arm_2d_location_t tFrom = tVertices[n];
+        arm_2d_location_t tTo = tVertices[(n + 1) % chCount];
+
+        nArea2 += (int32_t)tFrom.iX * tTo.iY - (int32_t)tTo.iX * tFrom.iY;
+    }
+
+    if (chCount < 3 || 0 == nArea2) {
+        /* nothing to fill */
+        return ARM_2D_ERR_NONE;
+    }
+
+    if (!__arm_2d_user_polygon_is_convex(tVertices, chCount)) {
+        /* the half planes only describe a convex polygon */
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    /* the bounding box, with one more pixel around for anti-alias */
+    int16_t iMinX = INT16_MAX, iMinY = INT16_MAX;
+    int16_t iMaxX = INT16_MIN, iMaxY = INT16_MIN;
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        iMinX = MIN(iMinX, tVertices[n].iX);
+        iMinY = MIN(iMinY, tVertices[n].iY);
+        iMaxX = MAX(iMaxX, tVertices[n].iX);
+        iMaxY = MAX(iMaxY, tVertices[n].iY);
+    }
+
+    arm_2d_region_t tTargetRegion = {0};
+    if (NULL == ptRegion) {
+        tTargetRegion.tSize = ptTarget->tRegion.tSize;
+    } else {
+        tTargetRegion = *ptRegion;
+    }
+
+    this.tDrawRegion = (arm_2d_region_t) {
+        .tLocation = {
+            .iX = iMinX - 1,
+            .iY = iMinY - 1,
+        },
+        .tSize = {
+            .iWidth = iMaxX - iMinX + 3,
+            .iHeight = iMaxY - iMinY + 3,
+        },
+    };
+
+    if (!arm_2d_region_intersect(&tTargetRegion, &this.tDrawRegion, &this.tDrawRegion)) {
+        return ARM_2D_ERR_NONE;
+    }
+
+    /* y grows downwards, so a positive area means clockwise on the screen */
+    int32_t nWinding = (nArea2 > 0) ? 1 : -1;
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        arm_2d_location_t tFrom = tVertices[n];
+        arm_2d_location_t tTo = tVertices[(n + 1) % chCount];
+
+        tFrom.iX -= tVertices[0].iX;
+        tFrom.iY -= tVertices[0].iY;
+        tTo.iX -= tVertices[0].iX;
+        tTo.iY -= tVertices[0].iY;
+
+        __arm_2d_user_polygon_prepare_edge( &this.tEdges[n],
+                                            tFrom,
+                                            tTo,
+                                            nWinding,
+                                            this.bAntiAlias);
+    }
+
+    this.chCount = chCount;
+    this.tOrigin = arm_2d_get_absolute_location(ptTarget, tVertices[0], true);
+
+    return ARM_2D_ERR_NONE;
+}
+
+/*
+ * The polygon opcode of each colour format
+ */
+
+#define __API_COLOUR                    gray8
+#define __API_COLOUR_UPPERCASE          GRAY8
+#define __API_INT_TYPE                  uint8_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_8BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_GRAY8
+
+#include "__arm_2d_user_opcode_fill_polygon.inc"
+
+#define __API_COLOUR                    rgb565
+#define __API_COLOUR_UPPERCASE          RGB565
+#define __API_INT_TYPE                  uint16_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_16BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_RGB565
+#define __API_SPAN_BLENDING_OPA         __arm_2d_user_rgb565_fill_span_opa
+
+#include "__arm_2d_user_opcode_fill_polygon.inc"
+
+#define __API_COLOUR                    cccn888
+#define __API_COLOUR_UPPERCASE          CCCN888
+#define __API_INT_TYPE                  uint32_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_32BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_CCCN888
+
+#include "__arm_2d_user_opcode_fill_polygon.inc"
+
+
+#ifdef   __cplusplus
+}
+#endif
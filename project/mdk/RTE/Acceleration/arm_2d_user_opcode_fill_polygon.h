@@ -0,0 +1,168 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __ARM_2D_USER_FILL_POLYGON_H__
+#define __ARM_2D_USER_FILL_POLYGON_H__
+
+/*============================ INCLUDES ======================================*/
+
+#include "arm_2d_helper.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#endif
+
+
+/*============================ MACROS ========================================*/
+
+/* the capacity of arm_2d_user_fill_polygon_descriptor_t */
+#ifndef ARM_2D_USER_FILL_POLYGON_MAX_VERTICES
+#   define ARM_2D_USER_FILL_POLYGON_MAX_VERTICES        8
+#endif
+
+/* the RGB565 op keeps its original name */
+#define ARM_2D_OP_USER_FILL_POLYGON     ARM_2D_OP_USER_FILL_POLYGON_RGB565
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+
+typedef struct arm_2d_user_fill_polygon_api_params_t {
+
+    /* the vertices of a convex polygon in the target tile, in any winding */
+    const arm_2d_location_t *ptVertices;
+    uint8_t chCount;
+    bool bAntiAlias;
+
+} arm_2d_user_fill_polygon_api_params_t;
+
+/*!
+ * \brief an edge as a half plane, a * dX + b * dY + c >= 0 is inside, where
+ *        dX and dY are relative to the first vertex
+ */
+typedef struct arm_2d_user_polygon_edge_t {
+    int32_t nA;                         /* the unit inner normal, Q14 */
+    int32_t nB;
+    int32_t nC;                         /* Q14 */
+
+    /* for the spans, Q16 */
+    int64_t lXPerRow;                   /* the X shift of the edge per row */
+    int64_t lXOuter;                    /* the X at dY = 0, where the edge */
+    int64_t lXInner;                    /*   is -0.5 and +0.5 pixel away   */
+} arm_2d_user_polygon_edge_t;
+
+
+typedef struct arm_2d_user_fill_polygon_descriptor_t {
+    implement(arm_2d_op_t);      /* inherit from base class arm_2d_op_t*/
+
+    arm_2d_user_polygon_edge_t tEdges[ARM_2D_USER_FILL_POLYGON_MAX_VERTICES];
+    uint8_t chCount;
+    bool bAntiAlias;
+
+    arm_2d_location_t tOrigin;          /* the absolute location of the first vertex */
+    arm_2d_region_t tDrawRegion;
+
+    uint8_t chOpacity;
+    union {
+        uint32_t wColour;               /* in the colour format of the op */
+        uint16_t hwColour;              /* the RGB565 colour, the original name */
+    };
+
+}arm_2d_user_fill_polygon_descriptor_t;
+
+
+/*============================ GLOBAL VARIABLES ==============================*/
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_FILL_POLYGON_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_FILL_POLYGON_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_FILL_POLYGON_CCCN888;
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief fill a convex polygon, e.g. a triangle, the gray8, rgb565 and
+ *        cccn888 versions are generated from the same template
+ * \param[in] ptOP the control block, it keeps the prepared edges and cannot
+ *            be NULL
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the clipping region in the target tile
+ * \param[in] ptParams the vertices, no more than
+ *            ARM_2D_USER_FILL_POLYGON_MAX_VERTICES, and the anti-alias option
+ * \param[in] tColour the colour of the polygon
+ * \param[in] chOpacity the opacity of the polygon
+ * \return arm_fsm_rt_t the operation result, ARM_2D_ERR_INVALID_PARAM when
+ *         the polygon is not convex or has too many vertices
+ */
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_fill_polygon(
+                    arm_2d_user_fill_polygon_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_fill_polygon_api_params_t *ptParams,
+                    arm_2d_color_gray8_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_rgb565_user_fill_polygon(
+                    arm_2d_user_fill_polygon_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_fill_polygon_api_params_t *ptParams,
+                    arm_2d_color_rgb565_t tColour,
+                    uint8_t chOpacity);
+
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_fill_polygon(
+                    arm_2d_user_fill_polygon_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_fill_polygon_api_params_t *ptParams,
+                    arm_2d_color_cccn888_t tColour,
+                    uint8_t chOpacity);
+
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+
+#endif /* __ARM_2D_USER_FILL_POLYGON_H__ */
@@ -0,0 +1,197 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+/*============================ INCLUDES ======================================*/
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+#include "__arm_2d_user_opcode_common.h"
+
+#include "arm_2d_user_opcode_radial_gradient.h"
+#include "arm_2d_helper.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-float-conversion"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wswitch-enum"
+#   pragma clang diagnostic ignored "-Wswitch"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#elif defined(__IS_COMPILER_GCC__)
+#   pragma GCC diagnostic ignored "-Wdiscarded-qualifiers"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#endif
+
+/*============================ MACROS ========================================*/
+#undef OP_CORE
+#define OP_CORE this.use_as__arm_2d_op_t.use_as__arm_2d_op_core_t
+#undef OPCODE
+#define OPCODE this.use_as__arm_2d_op_t
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief the distance of LUT entry n to the centre, in Q8 of the radius
+ * \note entry n covers distance^2 in [n, n + 1) / SIZE of radius^2, use the
+ *       distance in its middle, i.e. sqrt((2n + 1) / (2 * SIZE))
+ */
+__STATIC_INLINE
+uint32_t __arm_2d_user_radial_gradient_ratio(uint_fast16_t n)
+{
+    return __arm_2d_user_isqrt( ((uint32_t)(2 * n + 1) << 15)
+                              / ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE);
+}
+
+/*!
+ * \brief prepare the draw region and the opacity LUT, they don't depend on
+ *        the colour format
+ */
+static
+arm_2d_err_t __arm_2d_user_fill_radial_gradient_prepare(
+                            arm_2d_user_radial_gradient_descriptor_t *ptThis,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion,
+                            const arm_2d_user_radial_gradient_api_params_t *ptParams)
+{
+    int32_t nRadius = ptParams->iRadius;
+
+    this.iRadius = ptParams->iRadius;
+    this.tDrawRegion.tSize.iWidth = 0;
+    this.tDrawRegion.tSize.iHeight = 0;
+
+    if (nRadius <= 0) {
+        /* nothing to draw */
+        return ARM_2D_ERR_NONE;
+    }
+
+    arm_2d_region_t tTargetRegion = {0};
+    if (NULL == ptRegion) {
+        tTargetRegion.tSize = ptTarget->tRegion.tSize;
+    } else {
+        tTargetRegion = *ptRegion;
+    }
+
+    arm_2d_location_t tPivot;
+    if (ptParams->ptPivot) {
+        tPivot = *ptParams->ptPivot;
+    } else {
+        tPivot.iX = tTargetRegion.tLocation.iX + (tTargetRegion.tSize.iWidth >> 1);
+        tPivot.iY = tTargetRegion.tLocation.iY + (tTargetRegion.tSize.iHeight >> 1);
+    }
+
+    arm_2d_region_t tDrawRegion = {
+        .tLocation = {
+            .iX = tPivot.iX - nRadius,
+            .iY = tPivot.iY - nRadius,
+        },
+        .tSize = {
+            .iWidth = nRadius * 2 + 1,
+            .iHeight = nRadius * 2 + 1,
+        },
+    };
+
+    if (!arm_2d_region_intersect(&tTargetRegion, &tDrawRegion, &this.tDrawRegion)) {
+        this.tDrawRegion.tSize.iWidth = 0;
+        this.tDrawRegion.tSize.iHeight = 0;
+        return ARM_2D_ERR_NONE;
+    }
+
+    this.tPivot = arm_2d_get_absolute_location(ptTarget, tPivot, true);
+
+    /* LUT_SIZE / radius^2 rounded to the nearest, but no larger than what
+     * keeps the index of radius^2 - 1 within the LUT
+     */
+    uint32_t wRadius2 = (uint32_t)nRadius * (uint32_t)nRadius;
+    uint32_t wLUTScaled = (uint32_t)ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE
+                        << __ARM_2D_USER_RADIAL_GRADIENT_SCALE_BITS;
+
+    this.wScale = (wLUTScaled + (wRadius2 >> 1)) / wRadius2;
+    if (wRadius2 > 1) {
+        this.wScale = MIN(this.wScale, (wLUTScaled - 1) / (wRadius2 - 1));
+    }
+
+    int32_t nOpacityDelta = (int32_t)ptParams->chEdgeOpacity 
+                          - (int32_t)ptParams->chCentreOpacity;
+
+    for (uint_fast16_t n = 0; n < ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE; n++) {
+        uint32_t wRatio = __arm_2d_user_radial_gradient_ratio(n);
+
+        this.chOpacities[n] = (uint8_t)(ptParams->chCentreOpacity 
+                                     + ((nOpacityDelta * (int32_t)wRatio) >> 8));
+    }
+
+    return ARM_2D_ERR_NONE;
+}
+
+/*
+ * The radial gradient opcode of each colour format
+ */
+
+#define __API_COLOUR                    gray8
+#define __API_COLOUR_UPPERCASE          GRAY8
+#define __API_INT_TYPE                  uint8_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_8BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_GRAY8
+
+#include "__arm_2d_user_opcode_radial_gradient.inc"
+
+#define __API_COLOUR                    rgb565
+#define __API_COLOUR_UPPERCASE          RGB565
+#define __API_INT_TYPE                  uint16_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_16BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_RGB565
+
+#include "__arm_2d_user_opcode_radial_gradient.inc"
+
+#define __API_COLOUR                    cccn888
+#define __API_COLOUR_UPPERCASE          CCCN888
+#define __API_INT_TYPE                  uint32_t
+#define __API_COLOUR_SZ                 ARM_2D_COLOUR_SZ_32BIT
+#define __API_PIXEL_BLENDING_OPA        __ARM_2D_PIXEL_BLENDING_OPA_CCCN888
+
+#include "__arm_2d_user_opcode_radial_gradient.inc"
+
+
+#ifdef   __cplusplus
+}
+#endif
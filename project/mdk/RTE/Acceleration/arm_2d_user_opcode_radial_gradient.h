@@ -0,0 +1,154 @@
+/****************************************************************************
+*  Copyright 2025 Gorgon Meducer (Email:embedded_zhuoran@hotmail.com)       *
+*                                                                           *
+*  Licensed under the Apache License, Version 2.0 (the "License");          *
+*  you may not use this file except in compliance with the License.         *
+*  You may obtain a copy of the License at                                  *
+*                                                                           *
+*     http://www.apache.org/licenses/LICENSE-2.0                            *
+*                                                                           *
+*  Unless required by applicable law or agreed to in writing, software      *
+*  distributed under the License is distributed on an "AS IS" BASIS,        *
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. *
+*  See the License for the specific language governing permissions and      *
+*  limitations under the License.                                           *
+*                                                                           *
+****************************************************************************/
+
+#ifndef __ARM_2D_USER_RADIAL_GRADIENT_H__
+#define __ARM_2D_USER_RADIAL_GRADIENT_H__
+
+/*============================ INCLUDES ======================================*/
+
+#include "arm_2d_helper.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#endif
+
+
+/*============================ MACROS ========================================*/
+
+/* the number of steps from the centre to the edge, a power of 2 */
+#ifndef ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE
+#   define ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE         128
+#endif
+
+/* the fraction bits of wScale, distance^2 * wScale stays below
+ * LUT_SIZE << SCALE_BITS, which must fit into 32bit
+ */
+#define __ARM_2D_USER_RADIAL_GRADIENT_SCALE_BITS            22
+
+#if ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE > 512
+#   error ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE cannot be larger than 512
+#endif
+
+/* the RGB565 op keeps its original name */
+#define ARM_2D_OP_USER_FILL_RADIAL_GRADIENT                             \
+            ARM_2D_OP_USER_FILL_RADIAL_GRADIENT_RGB565
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+
+typedef struct arm_2d_user_radial_gradient_api_params_t {
+
+    arm_2d_location_t *ptPivot;         /* NULL means the centre of the region */
+    int16_t iRadius;
+
+    uint32_t wCentreColour;             /* in the colour format of the op */
+    uint32_t wEdgeColour;               /* in the colour format of the op */
+    uint8_t chCentreOpacity;
+    uint8_t chEdgeOpacity;
+
+} arm_2d_user_radial_gradient_api_params_t;
+
+
+typedef struct arm_2d_user_radial_gradient_descriptor_t {
+    implement(arm_2d_op_t);      /* inherit from base class arm_2d_op_t*/
+
+    arm_2d_location_t tPivot;           /* the absolute location of the pivot */
+    arm_2d_region_t tDrawRegion;
+    int16_t iRadius;
+
+    /* the LUT index is distance^2 * wScale >> SCALE_BITS */
+    uint32_t wScale;
+    uint32_t wColours[ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE];
+    uint8_t chOpacities[ARM_2D_USER_RADIAL_GRADIENT_LUT_SIZE];
+
+}arm_2d_user_radial_gradient_descriptor_t;
+
+
+/*============================ GLOBAL VARIABLES ==============================*/
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_FILL_RADIAL_GRADIENT_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_FILL_RADIAL_GRADIENT_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_USER_FILL_RADIAL_GRADIENT_CCCN888;
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief fill a disc with the colour and the opacity changing from the centre
+ *        to the edge, e.g. a glow
+ * \param[in] ptOP the control block, it keeps the LUT and cannot be NULL
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the clipping region in the target tile
+ * \param[in] ptParams the pivot, the radius, the colours and the opacities
+ * \return arm_fsm_rt_t the operation result
+ * \note the LUT and the draw region are prepared on the first PFB of a frame
+ * \note the colours in ptParams are in the colour format of the API, the
+ *       gray8, rgb565 and cccn888 versions are generated from the same template
+ */
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_gray8_user_fill_radial_gradient(
+                    arm_2d_user_radial_gradient_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_radial_gradient_api_params_t *ptParams);
+
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_rgb565_user_fill_radial_gradient(
+                    arm_2d_user_radial_gradient_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_radial_gradient_api_params_t *ptParams);
+
+extern
+ARM_NONNULL(1,2,4)
+arm_fsm_rt_t arm_2dp_cccn888_user_fill_radial_gradient(
+                    arm_2d_user_radial_gradient_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    const arm_2d_user_radial_gradient_api_params_t *ptParams);
+
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+
+#endif /* __ARM_2D_USER_RADIAL_GRADIENT_H__ */
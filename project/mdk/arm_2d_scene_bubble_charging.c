@@ -134,8 +134,13 @@ static void __on_scene_bubble_charging_depose(arm_2d_scene_t *ptScene)
 
     dynamic_nebula_depose(&this.tNebula);
 
+    /* the accumulator lives in the arena */
+    this.tBlurOP.tScratchMemory.pBuffer = (uintptr_t)NULL;
     ARM_2D_OP_DEPOSE(this.tBlurOP);
 
+    /* release the working-set in bulk */
+    mem_arena_depose(&this.tArena);
+
     if (!this.bUserAllocated) {
         __arm_2d_free_scratch_memory(ARM_2D_MEM_TYPE_UNSPECIFIED, ptScene);
     }
@@ -166,6 +171,9 @@ static void __on_scene_bubble_charging_frame_start(arm_2d_scene_t *ptScene)
     ARM_2D_UNUSED(ptThis);
     int32_t nResult;
 
+    /* release the frame allocations of the previous frame */
+    mem_arena_reset(&this.tArena);
+
     do {
         /* simulate a full battery charging/discharge cycle */
         arm_2d_helper_time_cos_slider(0, 1000, 120000, 0, &nResult, &this.lTimestamp[1]);
@@ -192,7 +200,8 @@ static void __on_scene_bubble_charging_frame_complete(arm_2d_scene_t *ptScene)
 //        arm_2d_scene_player_switch_to_next_scene(ptScene->ptPlayer);
 //    }
 
-    arm_2d_scratch_memory_free(&this.tBlurOP.tScratchMemory);
+    /* the accumulator is released by mem_arena_reset() on the next frame */
+    this.tBlurOP.tScratchMemory.pBuffer = (uintptr_t)NULL;
 
 }
 
@@ -248,24 +257,31 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_bubble_charging_handler)
                             255,
                             bIsNewFrame);
 
-        if (bIsNewFrame) {
+        /* the nebula lives in the centred square, so does the blur */
+        arm_2d_size_t tBlurSize = {
+            .iWidth = MIN(__charging_canvas.tSize.iWidth, __charging_canvas.tSize.iHeight),
+            .iHeight = MIN(__charging_canvas.tSize.iWidth, __charging_canvas.tSize.iHeight),
+        };
 
-            if (NULL == arm_2d_scratch_memory_new(  
-                                        &this.tBlurOP.tScratchMemory,
-                                        sizeof(__arm_2d_iir_blur_acc_t),
-                                        (   __charging_canvas.tSize.iHeight 
-                                        +   __charging_canvas.tSize.iWidth),
-                                        __alignof__(__arm_2d_iir_blur_acc_t),
-                                        ARM_2D_MEM_TYPE_FAST)) {
-                assert(false);  /* insufficient memory */
+        arm_2d_align_centre(__charging_canvas, tBlurSize) {
+
+            if (bIsNewFrame) {
+                this.tBlurOP.tScratchMemory.pBuffer 
+                    = (uintptr_t)mem_arena_alloc(
+                                        &this.tArena,
+                                        sizeof(__arm_2d_iir_blur_acc_t)
+                                    *   (tBlurSize.iWidth + tBlurSize.iHeight),
+                                        __alignof__(__arm_2d_iir_blur_acc_t));
             }
 
+            /* without the accumulator, the frame is drawn without the blur */
+            if ((uintptr_t)NULL != this.tBlurOP.tScratchMemory.pBuffer) {
+                arm_2dp_filter_iir_blur(&this.tBlurOP,
+                                        ptTile,
+                                        &__centre_region,
+                                        255 - 16);
+            }
         }
-        
-        arm_2dp_filter_iir_blur(&this.tBlurOP,
-                                ptTile,
-                                &__charging_canvas,
-                                255 - 16);
 
         arm_2d_align_centre(__charging_canvas, c_tileGlassBallMask.tRegion.tSize) {
 
@@ -412,6 +428,28 @@ user_scene_bubble_charging_t *__arm_2d_scene_bubble_charging_init(   arm_2d_scen
 
     ARM_2D_OP_INIT(this.tBlurOP);
 
+    /* 
+     * the working-set of the scene: the accumulator of the IIR blur covers 
+     * both the rows and the columns of the centred square, which fits in the
+     * fast pool (2 * 240 accumulators on a 320 * 240 screen).
+     */
+    do {
+        int16_t iSide = MIN(tScreen.tSize.iHeight, tScreen.tSize.iWidth);
+
+        if (!mem_arena_init(&this.tArena,
+                            sizeof(__arm_2d_iir_blur_acc_t) * (iSide * 2)
+                        +   __alignof__(__arm_2d_iir_blur_acc_t),
+                            ARM_2D_MEM_TYPE_FAST)) {
+            /* the arena is empty, the scene is drawn without the blur */
+            ARM_2D_LOG_WARNING(
+                APP, 
+                0, 
+                "Bubble Charging", 
+                "Insufficient memory for the blur, it is disabled"
+            );
+        }
+    } while(0);
+
     /* ------------   initialize members of user_scene_bubble_charging_t end   ---------------*/
 
     arm_2d_scene_player_append_scenes(  ptDispAdapter, 
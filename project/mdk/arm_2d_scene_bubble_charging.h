@@ -32,6 +32,8 @@
 #include "arm_2d_helper_scene.h"
 #include "arm_2d_example_controls.h"
 
+#include "mem_arena.h"
+
 #ifdef   __cplusplus
 extern "C" {
 #endif
@@ -87,6 +89,7 @@ ARM_PRIVATE(
     int64_t lTimestamp[3];
 
     arm_2d_filter_iir_blur_descriptor_t tBlurOP;
+    mem_arena_t tArena;
     dynamic_nebula_t tNebula;
     dynamic_nebula_particle_t tParticles[10];
 